@@ -0,0 +1,228 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Allocation tracking.
+ *
+ * Each new_Object() is counted, with the object header plus any
+ * payload its constructor mallocs, three ways:
+ *
+ *   - by type;
+ *   - by the Lisp procedure on top of the call stack kept for the
+ *     profiler (see profile.h);
+ *   - by the C function that asked for it, found by walking the native
+ *     stack past constructors such as cons() and make_string().
+ *
+ * Function names come from dladdr(), so the build links with -rdynamic.
+ * The tables are shared by all threads and not locked, so track
+ * allocations with one interpreter thread at a time.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "hash.h"
+#include "profile.h"
+#include "alloc.h"
+
+#ifdef ALLOC_TRACK
+
+#include <execinfo.h>
+#include <dlfcn.h>
+
+/* Entries in each keyed table; a full table counts into one overflow
+ * entry.
+ */
+#define ALLOC_TABLE_SIZE  4096
+#define ALLOC_BACKTRACE   16
+
+struct AllocCount {
+  void *key;
+  char *name;
+  long count;
+  long bytes;
+};
+
+/* A return address resolved to its function name. */
+struct AllocFrame {
+  void *address;
+  char *name;
+  int constructor;
+};
+
+static struct AllocCount by_type[BIGNUM + 1];
+static struct AllocCount by_proc[ALLOC_TABLE_SIZE + 1];
+static struct AllocCount by_caller[ALLOC_TABLE_SIZE + 1];
+static struct AllocFrame frames[ALLOC_TABLE_SIZE];
+
+/* Where the last object was counted, for its payload. */
+static struct AllocCount *last[3];
+
+/* Functions that only build objects for their callers. */
+static char *constructors[] = {
+  "alloc_track", "new_Object", "make_cell", "cons", "make_string_len",
+  "make_string", "make_symbol", "make_primitive", "make_proc",
+  "make_vector", "make_array", "make_hash_table", "make_fixnum",
+  "bignum_from_long", "big_box", NULL
+};
+
+struct AllocCount *alloc_count(struct AllocCount *table, void *key, char *name) {
+  unsigned long mask = ALLOC_TABLE_SIZE - 1;
+  unsigned long i = hash_pointer(key) & mask;
+
+  for (unsigned long probes = 0; probes < ALLOC_TABLE_SIZE; probes++) {
+    if (table[i].name == NULL) {
+      table[i].key = key;
+      table[i].name = name;
+      return &table[i];
+    }
+
+    if (table[i].key == key)
+      return &table[i];
+
+    i = (i + 1) & mask;
+  }
+
+  table[ALLOC_TABLE_SIZE].name = "(other)";
+  return &table[ALLOC_TABLE_SIZE];
+}
+
+struct AllocFrame *alloc_frame(void *address) {
+  unsigned long mask = ALLOC_TABLE_SIZE - 1;
+  unsigned long i = hash_pointer(address) & mask;
+  static struct AllocFrame unknown = { NULL, "?", 0 };
+
+  for (unsigned long probes = 0; probes < ALLOC_TABLE_SIZE; probes++) {
+    struct AllocFrame *frame = &frames[i];
+
+    if (frame->address == address)
+      return frame;
+
+    if (frame->address == NULL) {
+      Dl_info info;
+
+      frame->address = address;
+      frame->name = "?";
+      if (dladdr(address, &info) && info.dli_sname != NULL)
+        frame->name = (char *)info.dli_sname;
+
+      for (char **c = constructors; *c != NULL; c++) {
+        if (strcmp(*c, frame->name) == 0)
+          frame->constructor = 1;
+      }
+
+      return frame;
+    }
+
+    i = (i + 1) & mask;
+  }
+
+  return &unknown;
+}
+
+char *alloc_caller() {
+  void *trace[ALLOC_BACKTRACE];
+  int depth = backtrace(trace, ALLOC_BACKTRACE);
+
+  for (int i = 0; i < depth; i++) {
+    struct AllocFrame *frame = alloc_frame(trace[i]);
+
+    if (!frame->constructor)
+      return frame->name;
+  }
+
+  return "?";
+}
+
+void alloc_add(int which, struct AllocCount *count, long bytes) {
+  count->count++;
+  count->bytes += bytes;
+  last[which] = count;
+}
+
+void alloc_track(obj_type type) {
+  int depth = profile_depth;
+  Object *proc = NULL;
+  char *caller = alloc_caller();
+
+  if (depth > PROFILE_MAX_DEPTH)
+    depth = PROFILE_MAX_DEPTH;
+  if (depth > 0)
+    proc = profile_stack[depth - 1];
+
+  alloc_add(0, &by_type[type], sizeof(struct Object));
+  alloc_add(1, alloc_count(by_proc, proc,
+                           proc != NULL ? proc->symbol.name : "(toplevel)"),
+            sizeof(struct Object));
+  alloc_add(2, alloc_count(by_caller, caller, caller), sizeof(struct Object));
+}
+
+void alloc_track_bytes(long bytes) {
+  for (int i = 0; i < 3; i++) {
+    if (last[i] != NULL)
+      last[i]->bytes += bytes;
+  }
+}
+
+int compare_alloc_counts(const void *a, const void *b) {
+  const struct AllocCount *x = a, *y = b;
+
+  if (x->bytes != y->bytes)
+    return x->bytes < y->bytes ? 1 : -1;
+  return x->count < y->count ? 1 : x->count > y->count ? -1 : 0;
+}
+
+/* The ROWS largest entries by bytes. */
+void alloc_report_table(FILE *out, char *title, struct AllocCount *table, int size, int rows) {
+  struct AllocCount *sorted = malloc(size * sizeof(struct AllocCount));
+  int n = 0;
+
+  assert(sorted != NULL);
+  for (int i = 0; i < size; i++) {
+    if (table[i].count > 0)
+      sorted[n++] = table[i];
+  }
+
+  qsort(sorted, n, sizeof(struct AllocCount), compare_alloc_counts);
+
+  fprintf(out, "%s:\n%12s %14s  %s\n", title, "count", "bytes", "name");
+  for (int i = 0; i < n && i < rows; i++)
+    fprintf(out, "%12ld %14ld  %s\n", sorted[i].count, sorted[i].bytes, sorted[i].name);
+  if (n > rows)
+    fprintf(out, "%12s %14s  (%d more)\n", "", "", n - rows);
+
+  free(sorted);
+}
+
+void alloc_report(FILE *out) {
+  long count = 0, bytes = 0;
+
+  for (int i = 0; i <= BIGNUM; i++) {
+    by_type[i].name = type_name(i);
+    count += by_type[i].count;
+    bytes += by_type[i].bytes;
+  }
+
+  fprintf(out, "Allocations: %ld objects, %ld bytes\n", count, bytes);
+  alloc_report_table(out, "By type", by_type, BIGNUM + 1, BIGNUM + 1);
+  alloc_report_table(out, "By Lisp procedure", by_proc, ALLOC_TABLE_SIZE + 1, 20);
+  alloc_report_table(out, "By C caller", by_caller, ALLOC_TABLE_SIZE + 1, 20);
+}
+
+Object *primitive_alloc_report(Object *args) {
+  alloc_report(stdout);
+  return make_fixnum(gc_stats.allocs);
+}
+
+#else
+
+void alloc_report(FILE *out) {
+  fprintf(out, "Allocation tracking is off; build with -DALLOC_TRACK.\n");
+}
+
+Object *primitive_alloc_report(Object *args) {
+  alloc_report(stdout);
+  return s_nil;
+}
+
+#endif // ALLOC_TRACK
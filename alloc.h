@@ -0,0 +1,24 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Allocation tracking.
+ *
+ */
+
+/* Build with -DALLOC_TRACK (make CONFIG=alloc) to count every heap
+ * object and its malloc'd payload by type, by the Lisp procedure
+ * running, and by the C function that asked for it.  Without it the
+ * hooks below compile to nothing.
+ */
+#ifdef ALLOC_TRACK
+void alloc_track(obj_type type);
+void alloc_track_bytes(long bytes);
+#else
+#define alloc_track(type)
+#define alloc_track_bytes(bytes)
+#endif
+
+void alloc_report(FILE *out);
+
+Object *primitive_alloc_report(Object *args);
@@ -0,0 +1,535 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Unboxed numeric arrays.
+ *
+ * Elements are stored as plain int32_t or int64_t in one malloc'd
+ * block, so the GC never has to look inside them.  The bulk kernels
+ * use GCC/clang vector extensions, which compile to AVX2, SSE2 or
+ * NEON as available, with a scalar loop for the tail.  Build with
+ * -DARRAY_NO_SIMD to get the scalar loops only.  Element arithmetic
+ * wraps, as it would in C with unsigned types; array-sum and array-dot
+ * are exact and raise an error when the result does not fit an int64.
+ * Storing a value an element cannot hold is an error too.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "array.h"
+#include "alloc.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(ARRAY_NO_SIMD)
+#define ARRAY_SIMD
+
+typedef uint32_t v8u32 __attribute__((vector_size(32)));
+typedef int32_t  v8i32 __attribute__((vector_size(32)));
+typedef int32_t  v4i32 __attribute__((vector_size(16)));
+typedef uint64_t v4u64 __attribute__((vector_size(32)));
+typedef int64_t  v4i64 __attribute__((vector_size(32)));
+
+/* Unaligned loads and stores; these compile to single moves. */
+#define VLOAD(type, p)      ({ type v_; memcpy(&v_, (p), sizeof(v_)); v_; })
+#define VSTORE(p, v)        ({ __typeof__(v) v_ = (v); memcpy((p), &v_, sizeof(v_)); })
+#endif // ARRAY_SIMD
+
+/* dst[i] = a[i] OP b[i] */
+#define BINARY_KERNEL(name, type, utype, vutype, lanes, op)             \
+  void name(type *dst, type *a, type *b, int n) {                       \
+    int i = 0;                                                          \
+    SIMD_BINARY_BODY(vutype, lanes, op)                                 \
+    for (; i < n; i++)                                                  \
+      dst[i] = (type)((utype)a[i] op (utype)b[i]);                      \
+  }
+
+#ifdef ARRAY_SIMD
+#define SIMD_BINARY_BODY(vutype, lanes, op)                             \
+    for (; i + lanes <= n; i += lanes)                                  \
+      VSTORE(dst + i, VLOAD(vutype, a + i) op VLOAD(vutype, b + i));
+#else
+#define SIMD_BINARY_BODY(vutype, lanes, op)
+#endif // ARRAY_SIMD
+
+BINARY_KERNEL(array_add_i32, int32_t, uint32_t, v8u32, 8, +)
+BINARY_KERNEL(array_add_i64, int64_t, uint64_t, v4u64, 4, +)
+BINARY_KERNEL(array_mul_i32, int32_t, uint32_t, v8u32, 8, *)
+BINARY_KERNEL(array_mul_i64, int64_t, uint64_t, v4u64, 4, *)
+
+/* Sum the lanes of a four wide accumulator. */
+#define HSUM4(v) ((v)[0] + (v)[1] + (v)[2] + (v)[3])
+
+/* Sums of n int32s, or of n int64s cut into 32 bit halves, fit in 64
+ * bits for any int n, so these kernels are exact.  HIGH * 2^32 + LOW
+ * is the result, or *OVERFLOW is set if that does not fit an int64.
+ */
+int64_t join_halves(int64_t high, uint64_t low, int *overflow) {
+  __int128 total = (__int128)high * ((__int128)1 << 32) + low;
+
+  if (total > INT64_MAX || total < INT64_MIN) {
+    *overflow = 1;
+    return 0;
+  }
+
+  return (int64_t)total;
+}
+
+int64_t array_sum_i32(int32_t *a, int n) {
+  int64_t total = 0;
+  int i = 0;
+
+#ifdef ARRAY_SIMD
+  v4i64 acc = { 0 };
+  for (; i + 4 <= n; i += 4)
+    acc += __builtin_convertvector(VLOAD(v4i32, a + i), v4i64);
+  total = HSUM4(acc);
+#endif // ARRAY_SIMD
+
+  for (; i < n; i++)
+    total += a[i];
+
+  return total;
+}
+
+int64_t array_sum_i64(int64_t *a, int n, int *overflow) {
+  int64_t high = 0;
+  uint64_t low = 0;
+  int i = 0;
+
+#ifdef ARRAY_SIMD
+  v4i64 vhigh = { 0 };
+  v4u64 vlow = { 0 };
+  for (; i + 4 <= n; i += 4) {
+    v4i64 v = VLOAD(v4i64, a + i);
+    vhigh += v >> 32;
+    vlow += (v4u64)v & 0xffffffff;
+  }
+  high = HSUM4(vhigh);
+  low = HSUM4(vlow);
+#endif // ARRAY_SIMD
+
+  for (; i < n; i++) {
+    high += a[i] >> 32;
+    low += (uint64_t)a[i] & 0xffffffff;
+  }
+
+  return join_halves(high, low, overflow);
+}
+
+/* Each product of two int32s fits an int64; the products are summed in
+ * halves as in array_sum_i64().
+ */
+int64_t array_dot_i32(int32_t *a, int32_t *b, int n, int *overflow) {
+  int64_t high = 0;
+  uint64_t low = 0;
+  int i = 0;
+
+#ifdef ARRAY_SIMD
+  v4i64 vhigh = { 0 };
+  v4u64 vlow = { 0 };
+  for (; i + 4 <= n; i += 4) {
+    v4i64 p = __builtin_convertvector(VLOAD(v4i32, a + i), v4i64) *
+      __builtin_convertvector(VLOAD(v4i32, b + i), v4i64);
+    vhigh += p >> 32;
+    vlow += (v4u64)p & 0xffffffff;
+  }
+  high = HSUM4(vhigh);
+  low = HSUM4(vlow);
+#endif // ARRAY_SIMD
+
+  for (; i < n; i++) {
+    int64_t p = (int64_t)a[i] * b[i];
+
+    high += p >> 32;
+    low += (uint64_t)p & 0xffffffff;
+  }
+
+  return join_halves(high, low, overflow);
+}
+
+/* Products of int64s need 128 bits; there is no vector multiply for
+ * those, so this one is scalar.
+ */
+int64_t array_dot_i64(int64_t *a, int64_t *b, int n, int *overflow) {
+  __int128 total = 0;
+
+  for (int i = 0; i < n; i++) {
+    if (__builtin_add_overflow(total, (__int128)a[i] * b[i], &total)) {
+      *overflow = 1;
+      return 0;
+    }
+  }
+
+  if (total > INT64_MAX || total < INT64_MIN) {
+    *overflow = 1;
+    return 0;
+  }
+
+  return (int64_t)total;
+}
+
+/* Reduce with a branch-free select; N must be at least 1. */
+#define EXTREME_KERNEL(name, type, vtype, lanes, cmp)                   \
+  type name(type *a, int n) {                                           \
+    type best = a[0];                                                   \
+    int i = 0;                                                          \
+    SIMD_EXTREME_BODY(type, vtype, lanes, cmp)                          \
+    for (; i < n; i++)                                                  \
+      if (a[i] cmp best)                                                \
+        best = a[i];                                                    \
+    return best;                                                        \
+  }
+
+#ifdef ARRAY_SIMD
+#define SIMD_EXTREME_BODY(type, vtype, lanes, cmp)                      \
+    if (n >= lanes) {                                                   \
+      vtype acc = VLOAD(vtype, a);                                      \
+      for (i = lanes; i + lanes <= n; i += lanes) {                     \
+        vtype v = VLOAD(vtype, a + i);                                  \
+        vtype m = v cmp acc;                                            \
+        acc = (v & m) | (acc & ~m);                                     \
+      }                                                                 \
+      for (int j = 0; j < lanes; j++)                                   \
+        if (acc[j] cmp best)                                            \
+          best = acc[j];                                                \
+    }
+#else
+#define SIMD_EXTREME_BODY(type, vtype, lanes, cmp)
+#endif // ARRAY_SIMD
+
+EXTREME_KERNEL(array_min_i32, int32_t, v8i32, 8, <)
+EXTREME_KERNEL(array_min_i64, int64_t, v4i64, 4, <)
+EXTREME_KERNEL(array_max_i32, int32_t, v8i32, 8, >)
+EXTREME_KERNEL(array_max_i64, int64_t, v4i64, 4, >)
+
+/* A running sum is a serial dependency chain, so this stays scalar. */
+void array_prefix_sum_i32(int32_t *dst, int32_t *a, int n) {
+  uint32_t total = 0;
+
+  for (int i = 0; i < n; i++) {
+    total += a[i];
+    dst[i] = (int32_t)total;
+  }
+}
+
+void array_prefix_sum_i64(int64_t *dst, int64_t *a, int n) {
+  uint64_t total = 0;
+
+  for (int i = 0; i < n; i++) {
+    total += a[i];
+    dst[i] = (int64_t)total;
+  }
+}
+
+char *array_kind_name(int kind) {
+  if (kind == ARRAY_INT32)
+    return "int32";
+  else
+    return "int64";
+}
+
+int array_kind_from_symbol(Object *sym) {
+  if (is_symbol(sym) && strcmp(sym->symbol.name, "int32") == 0)
+    return ARRAY_INT32;
+  if (is_symbol(sym) && strcmp(sym->symbol.name, "int64") == 0)
+    return ARRAY_INT64;
+
+  error("Array kind must be int32 or int64");
+  return ARRAY_INT64;
+}
+
+Object *make_array(int kind, int len) {
+  Object *obj = NULL;
+
+  pin_variable((void **)&obj);
+  obj = new_Object(ARRAY);
+  obj->arr.kind = kind;
+  obj->arr.len = len;
+  obj->arr.data = calloc(len > 0 ? len : 1,
+                         kind == ARRAY_INT32 ? sizeof(int32_t) : sizeof(int64_t));
+  assert(obj->arr.data != NULL);
+  alloc_track_bytes((long)len * (kind == ARRAY_INT32 ? sizeof(int32_t) : sizeof(int64_t)));
+  unpin_variable((void **)&obj);
+  return obj;
+}
+
+long array_get(Object *a, int i) {
+  if (a->arr.kind == ARRAY_INT32)
+    return ((int32_t *)a->arr.data)[i];
+  else
+    return ((int64_t *)a->arr.data)[i];
+}
+
+/* Store VALUE at I, or error with MSG if it does not fit the kind. */
+void array_put(Object *a, int i, long value, char *msg) {
+  if (a->arr.kind == ARRAY_INT32) {
+    if (value < INT32_MIN || value > INT32_MAX)
+      error(msg);
+    ((int32_t *)a->arr.data)[i] = (int32_t)value;
+  } else
+    ((int64_t *)a->arr.data)[i] = value;
+}
+
+Object *check_array(Object *obj, char *msg) {
+  if (!is_array(obj))
+    error(msg);
+
+  return obj;
+}
+
+/* Both operands must be arrays of the same kind and length. */
+void check_array_pair(Object *a, Object *b, char *msg) {
+  if (!is_array(a) || !is_array(b) ||
+      a->arr.kind != b->arr.kind || a->arr.len != b->arr.len)
+    error(msg);
+}
+
+/* (make-array kind n [fill]) */
+Object *primitive_make_array(Object *args) {
+  int kind = array_kind_from_symbol(car(args));
+
+  if (!is_fixnum(cadr(args)) || fixnum_value(cadr(args)) < 0 ||
+      fixnum_value(cadr(args)) > INT_MAX)
+    error("make-array: bad length");
+
+  long fill = 0;
+  if (is_cell(cddr(args))) {
+    if (!is_fixnum(car(cddr(args))))
+      error("make-array: not a number");
+    fill = fixnum_value(car(cddr(args)));
+  }
+
+  Object *obj = make_array(kind, fixnum_value(cadr(args)));
+
+  for (int i = 0; i < obj->arr.len && fill != 0; i++)
+    array_put(obj, i, fill, "make-array: value out of range");
+
+  return obj;
+}
+
+/* (list->array kind list) */
+Object *primitive_list_to_array(Object *args) {
+  int kind = array_kind_from_symbol(car(args));
+  int len = 0;
+
+  for (Object *cell = cadr(args); is_cell(cell); cell = cdr(cell)) {
+    if (!is_fixnum(car(cell)))
+      error("list->array: not a number");
+    len++;
+  }
+
+  pin_variable((void **)&args);
+  Object *obj = make_array(kind, len);
+  unpin_variable((void **)&args);
+
+  Object *cell = cadr(args);
+  for (int i = 0; i < len; i++) {
+    array_put(obj, i, fixnum_value(car(cell)), "list->array: value out of range");
+    cell = cdr(cell);
+  }
+
+  return obj;
+}
+
+Object *primitive_array_to_list(Object *args) {
+  Object *a = check_array(car(args), "array->list: not an array");
+  Object *list = s_nil;
+  Object *elt = NULL;
+
+  pin_variable((void **)&a);
+  pin_variable((void **)&list);
+  pin_variable((void **)&elt);
+
+  for (int i = a->arr.len - 1; i >= 0; i--) {
+    elt = make_fixnum(array_get(a, i));
+    list = cons(elt, list);
+  }
+
+  unpin_variable((void **)&elt);
+  unpin_variable((void **)&list);
+  unpin_variable((void **)&a);
+  return list;
+}
+
+/* (array-iota kind n) => 0, 1, ... n-1 */
+Object *primitive_array_iota(Object *args) {
+  int kind = array_kind_from_symbol(car(args));
+
+  if (!is_fixnum(cadr(args)) || fixnum_value(cadr(args)) < 0 ||
+      fixnum_value(cadr(args)) > INT_MAX)
+    error("array-iota: bad length");
+
+  Object *obj = make_array(kind, fixnum_value(cadr(args)));
+
+  for (int i = 0; i < obj->arr.len; i++)
+    array_put(obj, i, i, "array-iota: value out of range");
+
+  return obj;
+}
+
+Object *primitive_array_length(Object *args) {
+  return make_fixnum(check_array(car(args), "array-length: not an array")->arr.len);
+}
+
+int array_index(Object *a, Object *i, char *msg) {
+  if (!is_array(a) || !is_fixnum(i) ||
+      fixnum_value(i) < 0 || fixnum_value(i) >= a->arr.len)
+    error(msg);
+
+  return fixnum_value(i);
+}
+
+Object *primitive_array_ref(Object *args) {
+  int i = array_index(car(args), cadr(args), "array-ref: bad index");
+
+  return make_fixnum(array_get(car(args), i));
+}
+
+Object *primitive_array_set(Object *args) {
+  int i = array_index(car(args), cadr(args), "array-set!: bad index");
+
+  if (!is_fixnum(car(cddr(args))))
+    error("array-set!: not a number");
+
+  check_writable(car(args));
+  array_put(car(args), i, fixnum_value(car(cddr(args))), "array-set!: value out of range");
+  return car(cddr(args));
+}
+
+Object *primitive_array_add(Object *args) {
+  check_array_pair(car(args), cadr(args), "array-add: mismatched arrays");
+
+  pin_variable((void **)&args);
+  Object *a = car(args), *b = cadr(args);
+  Object *obj = make_array(a->arr.kind, a->arr.len);
+  unpin_variable((void **)&args);
+
+  if (a->arr.kind == ARRAY_INT32)
+    array_add_i32(obj->arr.data, a->arr.data, b->arr.data, a->arr.len);
+  else
+    array_add_i64(obj->arr.data, a->arr.data, b->arr.data, a->arr.len);
+
+  return obj;
+}
+
+Object *primitive_array_mul(Object *args) {
+  check_array_pair(car(args), cadr(args), "array-mul: mismatched arrays");
+
+  pin_variable((void **)&args);
+  Object *a = car(args), *b = cadr(args);
+  Object *obj = make_array(a->arr.kind, a->arr.len);
+  unpin_variable((void **)&args);
+
+  if (a->arr.kind == ARRAY_INT32)
+    array_mul_i32(obj->arr.data, a->arr.data, b->arr.data, a->arr.len);
+  else
+    array_mul_i64(obj->arr.data, a->arr.data, b->arr.data, a->arr.len);
+
+  return obj;
+}
+
+Object *primitive_array_sum(Object *args) {
+  Object *a = check_array(car(args), "array-sum: not an array");
+
+  int overflow = 0;
+  int64_t total;
+
+  if (a->arr.kind == ARRAY_INT32)
+    total = array_sum_i32(a->arr.data, a->arr.len);
+  else
+    total = array_sum_i64(a->arr.data, a->arr.len, &overflow);
+
+  if (overflow)
+    error("array-sum: result out of range");
+  return make_fixnum(total);
+}
+
+Object *primitive_array_dot(Object *args) {
+  Object *a = car(args), *b = cadr(args);
+
+  check_array_pair(a, b, "array-dot: mismatched arrays");
+
+  int overflow = 0;
+  int64_t total;
+
+  if (a->arr.kind == ARRAY_INT32)
+    total = array_dot_i32(a->arr.data, b->arr.data, a->arr.len, &overflow);
+  else
+    total = array_dot_i64(a->arr.data, b->arr.data, a->arr.len, &overflow);
+
+  if (overflow)
+    error("array-dot: result out of range");
+  return make_fixnum(total);
+}
+
+Object *primitive_array_min(Object *args) {
+  Object *a = check_array(car(args), "array-min: not an array");
+
+  if (a->arr.len == 0)
+    return s_nil;
+
+  if (a->arr.kind == ARRAY_INT32)
+    return make_fixnum(array_min_i32(a->arr.data, a->arr.len));
+  else
+    return make_fixnum(array_min_i64(a->arr.data, a->arr.len));
+}
+
+Object *primitive_array_max(Object *args) {
+  Object *a = check_array(car(args), "array-max: not an array");
+
+  if (a->arr.len == 0)
+    return s_nil;
+
+  if (a->arr.kind == ARRAY_INT32)
+    return make_fixnum(array_max_i32(a->arr.data, a->arr.len));
+  else
+    return make_fixnum(array_max_i64(a->arr.data, a->arr.len));
+}
+
+Object *primitive_array_prefix_sum(Object *args) {
+  check_array(car(args), "array-prefix-sum: not an array");
+
+  pin_variable((void **)&args);
+  Object *a = car(args);
+  Object *obj = make_array(a->arr.kind, a->arr.len);
+  unpin_variable((void **)&args);
+
+  if (a->arr.kind == ARRAY_INT32)
+    array_prefix_sum_i32(obj->arr.data, a->arr.data, a->arr.len);
+  else
+    array_prefix_sum_i64(obj->arr.data, a->arr.data, a->arr.len);
+
+  return obj;
+}
+
+/* (array-map fn array)
+ * FN is called once per element, boxed, and must return a number.
+ */
+Object *primitive_array_map(Object *args) {
+  Object *fn = car(args);
+  Object *a = check_array(cadr(args), "array-map: not an array");
+  Object *result = NULL;
+  Object *arg = NULL;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&result);
+  pin_variable((void **)&arg);
+
+  result = make_array(a->arr.kind, a->arr.len);
+
+  for (int i = 0; i < a->arr.len; i++) {
+    arg = make_fixnum(array_get(a, i));
+    arg = cons(arg, s_nil);
+
+    Object *value = apply(fn, arg, top_env);
+    if (!is_fixnum(value))
+      error("array-map: function must return a number");
+
+    array_put(result, i, fixnum_value(value), "array-map: value out of range");
+  }
+
+  unpin_variable((void **)&arg);
+  unpin_variable((void **)&result);
+  unpin_variable((void **)&args);
+  return result;
+}
@@ -0,0 +1,43 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Unboxed numeric arrays.
+ *
+ */
+
+#include <stdint.h>
+
+/* Bulk kernels.  Most have a SIMD body and a scalar tail/fallback. */
+void array_add_i32(int32_t *dst, int32_t *a, int32_t *b, int n);
+void array_add_i64(int64_t *dst, int64_t *a, int64_t *b, int n);
+void array_mul_i32(int32_t *dst, int32_t *a, int32_t *b, int n);
+void array_mul_i64(int64_t *dst, int64_t *a, int64_t *b, int n);
+int64_t array_sum_i32(int32_t *a, int n);
+int64_t array_sum_i64(int64_t *a, int n, int *overflow);
+int64_t array_dot_i32(int32_t *a, int32_t *b, int n, int *overflow);
+int64_t array_dot_i64(int64_t *a, int64_t *b, int n, int *overflow);
+int32_t array_min_i32(int32_t *a, int n);
+int64_t array_min_i64(int64_t *a, int n);
+int32_t array_max_i32(int32_t *a, int n);
+int64_t array_max_i64(int64_t *a, int n);
+void array_prefix_sum_i32(int32_t *dst, int32_t *a, int n);
+void array_prefix_sum_i64(int64_t *dst, int64_t *a, int n);
+
+Object *make_array(int kind, int len);
+
+Object *primitive_make_array(Object *args);
+Object *primitive_list_to_array(Object *args);
+Object *primitive_array_to_list(Object *args);
+Object *primitive_array_iota(Object *args);
+Object *primitive_array_length(Object *args);
+Object *primitive_array_ref(Object *args);
+Object *primitive_array_set(Object *args);
+Object *primitive_array_add(Object *args);
+Object *primitive_array_mul(Object *args);
+Object *primitive_array_sum(Object *args);
+Object *primitive_array_dot(Object *args);
+Object *primitive_array_min(Object *args);
+Object *primitive_array_max(Object *args);
+Object *primitive_array_prefix_sum(Object *args);
+Object *primitive_array_map(Object *args);
@@ -0,0 +1,10 @@
+; Allocation storm: build and drop 10000-cell lists until the heap
+; has been collected several times over.
+(define build (lambda (n acc) (if (eq n 0) acc (build (- n 1) (cons n acc)))))
+(define storm (lambda (n) (if (eq n 0) 0 (storm2 n (build 10000 nil)))))
+(define storm2 (lambda (n garbage) (storm (- n 1))))
+(storm 20)
+(storm 20)
+(storm 20)
+(storm 20)
+(storm 20)
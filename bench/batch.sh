@@ -0,0 +1,40 @@
+#!/bin/sh
+#
+# JCM-LISP batch mode against the REPL.
+#
+# Usage: bench/batch.sh BINARY [FORMS]
+#
+# Runs bench/*.lsp, plus a generated script of FORMS top-level forms
+# (default 5000), through bench/run.sh twice: piped into the REPL and
+# as a file argument.  Prints, per workload, the median wall time in ms
+# of each and the batch speedup.
+
+BIN=${1:?usage: bench/batch.sh BINARY [FORMS]}
+FORMS=${2:-5000}
+
+DIR=$(dirname "$0")
+TMP=${TMPDIR:-/tmp}/jcm-batch.$$
+trap 'rm -rf "$TMP" "$TMP".*' EXIT
+
+# Definitions and calls, the shape of a generated script.
+mkdir -p "$TMP"
+awk -v n="$FORMS" 'BEGIN {
+  for (i = 0; i < n / 2; i++) {
+    printf "(define f%d (lambda (x) (+ x %d)))\n", i, i
+    printf "(f%d %d)\n", i, i
+  }
+}' > "$TMP/generated.lsp"
+
+for mode in repl batch; do
+  BENCH_MODE=$mode "$DIR/run.sh" "$BIN" "$TMP/generated.lsp" "$DIR"/*.lsp > "$TMP.$mode" || exit 1
+  # benchmark,median_ms
+  tail -n +2 "$TMP.$mode" | sort -t, -k1,1 -k3,3n |
+    awk -F, '{ t[$1] = t[$1] " " $3; c[$1]++ }
+             END { for (b in t) { split(substr(t[b], 2), v, " ");
+                                  print b "," v[int((c[b] + 1) / 2)] } }' |
+    sort > "$TMP.m$mode"
+done
+
+echo "benchmark,repl_ms,batch_ms,speedup"
+join -t, "$TMP.mrepl" "$TMP.mbatch" |
+  awk -F, '{ printf "%s,%s,%s,%.2f\n", $1, $2, $3, $2 / $3 }'
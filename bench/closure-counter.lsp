@@ -0,0 +1,14 @@
+; Closure counters as in testR.lsp: setq on a captured variable.
+(define count
+    ((lambda (total)
+       (lambda (increment)
+         (setq total (+ total increment))
+         total))
+     0))
+(define step (lambda (n) (count 1) (- n 1)))
+(define run (lambda (n) (if (eq n 0) (count 0) (run (step n)))))
+(run 10000)
+(run 10000)
+(run 10000)
+(run 10000)
+(run 10000)
@@ -0,0 +1,18 @@
+; Closures made in frames that also hold a 500 element list.  Each
+; closure uses only n, so flat closures let the lists be collected;
+; closures over the whole environment keep every list alive until the
+; closures themselves go.  Three rounds, so collections happen while a
+; round's closures are live.
+(define make
+    (lambda (n)
+      (let ((big (array->list (array-iota 'int64 500))))
+        (lambda () n))))
+(define closures nil)
+(define round
+    (lambda ()
+      (setq closures nil)
+      (dotimes (i 3600) (setq closures (cons (make i) closures)))
+      ((car closures))))
+(round)
+(round)
+(round)
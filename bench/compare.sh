@@ -0,0 +1,47 @@
+#!/bin/sh
+#
+# JCM-LISP build comparison.
+#
+# Usage: bench/compare.sh BASELINE BINARY...
+#
+# Runs bench/run.sh over bench/*.lsp with each binary and prints, per
+# workload, the median wall time in ms for each binary.  The last row
+# sums the medians and gives each binary's speedup over BASELINE.
+
+[ $# -ge 2 ] || { echo "usage: bench/compare.sh BASELINE BINARY..." >&2; exit 1; }
+
+DIR=$(dirname "$0")
+TMP=${TMPDIR:-/tmp}/jcm-compare.$$
+trap 'rm -f "$TMP".*' EXIT
+
+n=0
+for bin in "$@"; do
+  n=$((n + 1))
+  "$DIR/run.sh" "$bin" "$DIR"/*.lsp > "$TMP.$n" || exit 1
+done
+
+for i in $(seq 1 $n); do
+  # benchmark,median_ms for binary i
+  tail -n +2 "$TMP.$i" | sort -t, -k1,1 -k3,3n |
+    awk -F, '{ t[$1] = t[$1] " " $3; c[$1]++ }
+             END { for (b in t) { split(substr(t[b], 2), v, " ");
+                                  print b "," v[int((c[b] + 1) / 2)] } }' |
+    sort > "$TMP.m$i"
+done
+
+{
+  printf "benchmark"
+  for bin in "$@"; do printf ",%s" "$bin"; done
+  echo
+  cp "$TMP.m1" "$TMP.all"
+  for i in $(seq 2 $n); do
+    join -t, "$TMP.all" "$TMP.m$i" > "$TMP.j" && mv "$TMP.j" "$TMP.all"
+  done
+  cat "$TMP.all"
+} | awk -F, 'NR == 1 { print; next }
+             { print; for (i = 2; i <= NF; i++) sum[i] += $i; nf = NF }
+             END { printf "total";
+                   for (i = 2; i <= nf; i++) printf ",%.1f", sum[i];
+                   printf "\nspeedup";
+                   for (i = 2; i <= nf; i++) printf ",%.3f", sum[2] / sum[i];
+                   print "" }'
@@ -0,0 +1,12 @@
+; Deep non-tail recursion: one eval/apply frame per level.
+(define deep (lambda (n) (if (eq n 0) 0 (+ 1 (deep (- n 1))))))
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
+(deep 10000)
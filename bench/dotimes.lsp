@@ -0,0 +1,4 @@
+; A 10^7 iteration counting loop.  dotimes updates its binding in place
+; and the body allocates nothing, so this should run without a GC.
+(define count (lambda (n) (dotimes (i n i) i)))
+(count 10000000)
@@ -0,0 +1,129 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Embedding latency.
+ *
+ * Usage: embed JCM_LISP_BINARY [RUNS]
+ *
+ * Checks the embedding API (a C primitive, values back as C values,
+ * recovery from errors), then times RUNS evaluations of the same text
+ * in one embedded interpreter against piping it to a new process each
+ * time.  Prints CSV:
+ *
+ *   mode,runs,total_ms,per_eval_us
+ *
+ */
+
+#include <unistd.h>
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "embed.h"
+
+#define EMBED_HEAP_SIZE  (1 << 16)
+
+static char *workload =
+  "(define sq (lambda (x) (* x x)))\n"
+  "(host-scale (sq 12))\n";
+
+/* (host-scale n) => n * 10, or an error for anything but a fixnum. */
+Object *host_scale(Object *args) {
+  long n;
+
+  if (!value_to_long(car(args), &n))
+    error("host-scale: not an integer");
+  return make_fixnum(n * 10);
+}
+
+void check(int ok, char *what) {
+  if (!ok) {
+    fprintf(stderr, "embed: %s\n", what);
+    exit(1);
+  }
+}
+
+void check_api() {
+  struct Interp *in = interp_new(EMBED_HEAP_SIZE);
+  Object *result = NULL;
+  long n = 0;
+
+  interp_define_primitive(in, "host-scale", host_scale);
+  interp_define(in, "greeting", make_string("hello"));
+
+  check(interp_eval_string(in, workload, strlen(workload), &result) == 0, "eval failed");
+  check(value_to_long(result, &n) && n == 1440, "wrong result");
+
+  check(interp_eval_string(in, "greeting", 8, &result) == 0, "lookup failed");
+  check(strcmp(value_to_string(result), "hello") == 0, "wrong string");
+
+  int pins = pinned_variable_count;
+  char *bad = "(sq (host-scale \"x\"))";
+
+  check(interp_eval_string(in, bad, strlen(bad), &result) == -1, "error not reported");
+  check(strcmp(interp_error(in), "host-scale: not an integer") == 0, "wrong error");
+  check(pinned_variable_count == pins, "pins left after error");
+
+  char *big = "(* 4611686018427387904 2)";
+
+  check(interp_eval_string(in, big, strlen(big), &result) == 0, "bignum eval failed");
+  check(!value_to_long(result, &n), "2^63 fits in a long");
+
+  check(interp_eval_string(in, "(sq 3)", 6, &result) == 0, "eval after error failed");
+  check(value_to_long(result, &n) && n == 9, "wrong result after error");
+
+  interp_free(in);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s JCM_LISP_BINARY [RUNS]\n", argv[0]);
+    return 2;
+  }
+
+  char *binary = argv[1];
+  int runs = argc > 2 ? atoi(argv[2]) : 100;
+  char command[1024];
+
+  // The interpreters print to stdout, so results go to a copy of it.
+  FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+
+  if (out == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+    fprintf(stderr, "embed: cannot discard output\n");
+    return 1;
+  }
+
+  check_api();
+
+  struct Interp *in = interp_new(EMBED_HEAP_SIZE);
+  interp_define_primitive(in, "host-scale", host_scale);
+
+  double start = now_seconds();
+
+  for (int i = 0; i < runs; i++)
+    check(interp_eval_string(in, workload, strlen(workload), NULL) == 0, "eval failed");
+
+  double embedded = now_seconds() - start;
+
+  interp_free(in);
+
+  // The process has no host-scale, so it gets the text without that call.
+  snprintf(command, sizeof(command), "%s > /dev/null", binary);
+  start = now_seconds();
+
+  for (int i = 0; i < runs; i++) {
+    FILE *pipe = popen(command, "w");
+
+    check(pipe != NULL, "cannot start interpreter");
+    fputs("(define sq (lambda (x) (* x x)))\n(* (sq 12) 10)\n", pipe);
+    check(pclose(pipe) == 0, "interpreter failed");
+  }
+
+  double spawned = now_seconds() - start;
+
+  fprintf(out, "mode,runs,total_ms,per_eval_us\n");
+  fprintf(out, "embedded,%d,%.3f,%.1f\n", runs, embedded * 1000, embedded * 1e6 / runs);
+  fprintf(out, "process,%d,%.3f,%.1f\n", runs, spawned * 1000, spawned * 1e6 / runs);
+  fclose(out);
+  return 0;
+}
@@ -0,0 +1,15 @@
+; equal-list.lsp with the comparison written in Lisp, as it had to be
+; before equal was a primitive.
+(car (define xs (array->list (array-iota 'int64 100000))))
+(car (define ys (array->list (array-iota 'int64 100000))))
+(define list-equal
+  (lambda (a b)
+    (let ((same 1))
+      (while (and same a b)
+        (if (eq (car a) (car b))
+            (begin (setq a (cdr a)) (setq b (cdr b)))
+            (setq same nil)))
+      (if a nil (if b nil same)))))
+(list-equal xs ys)
+(list-equal xs ys)
+(list-equal xs ys)
@@ -0,0 +1,8 @@
+; Compare two equal lists of 100000 numbers with the native equal.
+; equal-list-lisp.lsp does the same with a loop in Lisp.
+(car (define xs (array->list (array-iota 'int64 100000))))
+(car (define ys (array->list (array-iota 'int64 100000))))
+(equal xs ys)
+(equal xs ys)
+(equal xs ys)
+(sxhash xs)
@@ -0,0 +1,10 @@
+; Factorial of large inputs: a bignum times a fixnum at each step,
+; then big-times-big squares wide enough to take the Karatsuba path.
+(define fact (lambda (n) (if (eq n 0) 1 (* n (fact (- n 1))))))
+(define f (fact 1000))
+(string-length (number->string f))
+(string-length (number->string (fact 1000)))
+(string-length (number->string (fact 1000)))
+(string-length (number->string (* f f)))
+(string-length (number->string (* (* f f) (* f f))))
+(string-length (number->string (/ (* f f) f)))
@@ -0,0 +1,4 @@
+; Doubly recursive Fibonacci on fixnums: calls and small arithmetic,
+; the kind of procedure a -DJIT build compiles.
+(define fib (lambda (n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2))))))
+(fib 25)
@@ -0,0 +1,8 @@
+; Fibonacci of large inputs by iteration: long chains of bignum adds.
+(define fib-iter (lambda (a b n) (if (eq n 0) a (fib-iter b (+ a b) (- n 1)))))
+(define fib (lambda (n) (fib-iter 0 1 n)))
+(string-length (number->string (fib 3000)))
+(string-length (number->string (fib 3000)))
+(string-length (number->string (fib 3000)))
+(string-length (number->string (fib 3000)))
+(string-length (number->string (fib 3000)))
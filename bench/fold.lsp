@@ -0,0 +1,7 @@
+; Arithmetic on constants, a constant if test and car of quoted data,
+; as generated code tends to have.  All of it folds away before the
+; loop runs, leaving (+ (* x 3600) 144 3).
+(define scale (lambda (x) (+ (* x (* 60 60)) (if (< 1 2) (* 24 (- 10 4)) 0) (car '(3 4)))))
+(define total 0)
+(define run (lambda (n) (dotimes (i n total) (setq total (+ total (scale i))))))
+(run 1000000)
@@ -0,0 +1,11 @@
+; The loop of macro-when.lsp with its when and unless written as ifs.
+(define evens 0)
+(define odds 0)
+(define tally
+    (lambda (n)
+      (dotimes (i n)
+        (if (< (- i (* (/ i 2) 2)) 1) (setq evens (+ evens 1)))
+        (if (< (- i (* (/ i 2) 2)) 1) nil (setq odds (+ odds 1))))))
+(tally 200000)
+(tally 200000)
+(tally 200000)
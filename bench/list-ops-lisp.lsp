@@ -0,0 +1,42 @@
+; list-ops.lsp with each list function defined in Lisp, iteratively
+; where the native one is, as programs had to before the library.
+(define my-length (lambda (l) (let ((n 0)) (while l (setq n (+ n 1)) (setq l (cdr l))) n)))
+(define my-reverse (lambda (l) (let ((acc nil)) (while l (setq acc (cons (car l) acc)) (setq l (cdr l))) acc)))
+(define my-append (lambda (a b) (let ((acc (my-reverse a))) (while acc (setq b (cons (car acc) b)) (setq acc (cdr acc))) b)))
+(define my-nth (lambda (n l) (dotimes (i n) (setq l (cdr l))) (car l)))
+(define my-member (lambda (x l) (let ((found nil)) (while l (if (eq x (car l)) (begin (setq found l) (setq l nil)) (setq l (cdr l)))) found)))
+(define my-assoc (lambda (k l) (let ((found nil)) (while l (if (eq k (car (car l))) (begin (setq found (car l)) (setq l nil)) (setq l (cdr l)))) found)))
+(define my-map (lambda (f l) (let ((acc nil)) (while l (setq acc (cons (f (car l)) acc)) (setq l (cdr l))) (my-reverse acc))))
+(define my-filter (lambda (p l) (let ((acc nil)) (while l (if (p (car l)) (setq acc (cons (car l) acc))) (setq l (cdr l))) (my-reverse acc))))
+(define my-reduce (lambda (f l acc) (while l (setq acc (f acc (car l))) (setq l (cdr l))) acc))
+(define my-take (lambda (l n) (let ((acc nil)) (dotimes (i n) (setq acc (cons (car l) acc)) (setq l (cdr l))) (my-reverse acc))))
+(define my-drop (lambda (l n) (dotimes (i n) (setq l (cdr l))) l))
+(define my-merge
+  (lambda (a b less)
+    (let ((acc nil))
+      (while (and a b)
+        (if (less (car b) (car a))
+            (begin (setq acc (cons (car b) acc)) (setq b (cdr b)))
+            (begin (setq acc (cons (car a) acc)) (setq a (cdr a)))))
+      (my-append (my-reverse acc) (if a a b)))))
+(define my-sort
+  (lambda (l less)
+    (let ((n (my-length l)))
+      (if (< n 2)
+          l
+          (let ((h (/ n 2)))
+            (my-merge (my-sort (my-take l h) less) (my-sort (my-drop l h) less) less))))))
+(car (define xs (array->list (array-iota 'int64 10000))))
+(car (define al (my-map (lambda (x) (cons x x)) xs)))
+(car (define ys (my-reverse xs)))
+(dotimes (i 5) (my-length xs))
+(dotimes (i 5) (my-append xs xs))
+(dotimes (i 5) (my-reverse xs))
+(dotimes (i 5) (my-nth 9999 xs))
+(dotimes (i 5) (my-member 9999 xs))
+(dotimes (i 5) (my-assoc 9999 al))
+(dotimes (i 5) (my-map (lambda (x) (+ x 1)) xs))
+(dotimes (i 5) (my-filter (lambda (x) (< x 5000)) xs))
+(dotimes (i 5) (my-reduce + xs 0))
+(car (my-sort ys <))
+(car (my-sort ys (lambda (a b) (< a b))))
@@ -0,0 +1,16 @@
+; The native list library over 10000 element lists.  list-ops-lisp.lsp
+; runs the same operations written in Lisp.
+(car (define xs (array->list (array-iota 'int64 10000))))
+(car (define al (map (lambda (x) (cons x x)) xs)))
+(car (define ys (reverse xs)))
+(dotimes (i 5) (length xs))
+(dotimes (i 5) (append xs xs))
+(dotimes (i 5) (reverse xs))
+(dotimes (i 5) (nth 9999 xs))
+(dotimes (i 5) (member 9999 xs))
+(dotimes (i 5) (assoc 9999 al))
+(dotimes (i 5) (map (lambda (x) (+ x 1)) xs))
+(dotimes (i 5) (filter (lambda (x) (< x 5000)) xs))
+(dotimes (i 5) (reduce + xs 0))
+(car (sort ys <))
+(car (sort ys (lambda (a b) (< a b))))
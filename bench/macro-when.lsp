@@ -0,0 +1,17 @@
+; when and unless as macros.  Each call site is expanded once, then
+; runs as the if it became: same loop as if-when.lsp, which writes the
+; ifs by hand.
+(defmacro when (test . body)
+  (cons 'if (cons test (cons (if (cdr body) (cons 'begin body) (car body)) nil))))
+(defmacro unless (test . body)
+  (cons 'if (cons test (cons nil (cons (if (cdr body) (cons 'begin body) (car body)) nil)))))
+(define evens 0)
+(define odds 0)
+(define tally
+    (lambda (n)
+      (dotimes (i n)
+        (when (< (- i (* (/ i 2) 2)) 1) (setq evens (+ evens 1)))
+        (unless (< (- i (* (/ i 2) 2)) 1) (setq odds (+ odds 1))))))
+(tally 200000)
+(tally 200000)
+(tally 200000)
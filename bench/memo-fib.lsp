@@ -0,0 +1,6 @@
+; fib-recursive behind memoize: each argument is computed once, so
+; the calls drop from exponential to linear in n.  Compare with
+; bench/fib-recursive.lsp.
+(define fib (memoize (lambda (n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2))))) :max-entries 8))
+(fib 25)
+(memoize-stats fib)
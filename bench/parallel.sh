@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# JCM-LISP parallel-map benchmark.
+#
+# Usage: bench/parallel.sh BINARY [THREADS...]
+#
+# Maps a naive Fibonacci over a list of equal inputs with parallel-map
+# once for each thread count (default 1 2 4 8, set through JCM_THREADS)
+# and prints one CSV row per count:
+#
+#   threads,wall_ms,speedup
+#
+# The speedup is against the first count.  It cannot exceed the number
+# of CPUs the machine has.  BINARY must be built with -DGC_STATS.
+
+BIN=${1:?usage: bench/parallel.sh BINARY [THREADS...]}
+shift
+COUNTS=${*:-1 2 4 8}
+
+TMP=${TMPDIR:-/tmp}/jcm-parallel.$$
+trap 'rm -rf "$TMP"' EXIT
+mkdir -p "$TMP"
+
+cat > "$TMP/fib.lsp" <<'LISP'
+(define fib (lambda (n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2))))))
+(parallel-map fib '(20 20 20 20 20 20 20 20 20 20 20 20 20 20 20 20))
+LISP
+
+echo "threads,wall_ms,speedup"
+
+base=
+for n in $COUNTS; do
+  out=$(JCM_THREADS=$n "$BIN" "$TMP/fib.lsp" 2>&1) ||
+    { echo "$BIN failed with $n threads" >&2; exit 1; }
+  ms=$(echo "$out" | grep '^stats ' | tr ' ' '\n' | sed -n 's/^wall_ms=//p')
+  [ -n "$base" ] || base=$ms
+  awk -v n="$n" -v ms="$ms" -v base="$base" \
+    'BEGIN { printf "%d,%d,%.2f\n", n, ms, (ms > 0 ? base / ms : 0) }'
+done
@@ -0,0 +1,7 @@
+; Large list printing: the REPL prints each 100000-element list.
+(define xs (array->list (array-iota 'int64 100000)))
+xs
+xs
+xs
+xs
+xs
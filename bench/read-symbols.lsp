@@ -0,0 +1,802 @@
+; Symbol-heavy reading: 4000 distinct symbols, each interned once
+; and then looked up again.
+'(sym-0-0 sym-0-1 sym-0-2 sym-0-3 sym-0-4 sym-0-5 sym-0-6 sym-0-7 sym-0-8 sym-0-9)
+'(sym-1-0 sym-1-1 sym-1-2 sym-1-3 sym-1-4 sym-1-5 sym-1-6 sym-1-7 sym-1-8 sym-1-9)
+'(sym-2-0 sym-2-1 sym-2-2 sym-2-3 sym-2-4 sym-2-5 sym-2-6 sym-2-7 sym-2-8 sym-2-9)
+'(sym-3-0 sym-3-1 sym-3-2 sym-3-3 sym-3-4 sym-3-5 sym-3-6 sym-3-7 sym-3-8 sym-3-9)
+'(sym-4-0 sym-4-1 sym-4-2 sym-4-3 sym-4-4 sym-4-5 sym-4-6 sym-4-7 sym-4-8 sym-4-9)
+'(sym-5-0 sym-5-1 sym-5-2 sym-5-3 sym-5-4 sym-5-5 sym-5-6 sym-5-7 sym-5-8 sym-5-9)
+'(sym-6-0 sym-6-1 sym-6-2 sym-6-3 sym-6-4 sym-6-5 sym-6-6 sym-6-7 sym-6-8 sym-6-9)
+'(sym-7-0 sym-7-1 sym-7-2 sym-7-3 sym-7-4 sym-7-5 sym-7-6 sym-7-7 sym-7-8 sym-7-9)
+'(sym-8-0 sym-8-1 sym-8-2 sym-8-3 sym-8-4 sym-8-5 sym-8-6 sym-8-7 sym-8-8 sym-8-9)
+'(sym-9-0 sym-9-1 sym-9-2 sym-9-3 sym-9-4 sym-9-5 sym-9-6 sym-9-7 sym-9-8 sym-9-9)
+'(sym-10-0 sym-10-1 sym-10-2 sym-10-3 sym-10-4 sym-10-5 sym-10-6 sym-10-7 sym-10-8 sym-10-9)
+'(sym-11-0 sym-11-1 sym-11-2 sym-11-3 sym-11-4 sym-11-5 sym-11-6 sym-11-7 sym-11-8 sym-11-9)
+'(sym-12-0 sym-12-1 sym-12-2 sym-12-3 sym-12-4 sym-12-5 sym-12-6 sym-12-7 sym-12-8 sym-12-9)
+'(sym-13-0 sym-13-1 sym-13-2 sym-13-3 sym-13-4 sym-13-5 sym-13-6 sym-13-7 sym-13-8 sym-13-9)
+'(sym-14-0 sym-14-1 sym-14-2 sym-14-3 sym-14-4 sym-14-5 sym-14-6 sym-14-7 sym-14-8 sym-14-9)
+'(sym-15-0 sym-15-1 sym-15-2 sym-15-3 sym-15-4 sym-15-5 sym-15-6 sym-15-7 sym-15-8 sym-15-9)
+'(sym-16-0 sym-16-1 sym-16-2 sym-16-3 sym-16-4 sym-16-5 sym-16-6 sym-16-7 sym-16-8 sym-16-9)
+'(sym-17-0 sym-17-1 sym-17-2 sym-17-3 sym-17-4 sym-17-5 sym-17-6 sym-17-7 sym-17-8 sym-17-9)
+'(sym-18-0 sym-18-1 sym-18-2 sym-18-3 sym-18-4 sym-18-5 sym-18-6 sym-18-7 sym-18-8 sym-18-9)
+'(sym-19-0 sym-19-1 sym-19-2 sym-19-3 sym-19-4 sym-19-5 sym-19-6 sym-19-7 sym-19-8 sym-19-9)
+'(sym-20-0 sym-20-1 sym-20-2 sym-20-3 sym-20-4 sym-20-5 sym-20-6 sym-20-7 sym-20-8 sym-20-9)
+'(sym-21-0 sym-21-1 sym-21-2 sym-21-3 sym-21-4 sym-21-5 sym-21-6 sym-21-7 sym-21-8 sym-21-9)
+'(sym-22-0 sym-22-1 sym-22-2 sym-22-3 sym-22-4 sym-22-5 sym-22-6 sym-22-7 sym-22-8 sym-22-9)
+'(sym-23-0 sym-23-1 sym-23-2 sym-23-3 sym-23-4 sym-23-5 sym-23-6 sym-23-7 sym-23-8 sym-23-9)
+'(sym-24-0 sym-24-1 sym-24-2 sym-24-3 sym-24-4 sym-24-5 sym-24-6 sym-24-7 sym-24-8 sym-24-9)
+'(sym-25-0 sym-25-1 sym-25-2 sym-25-3 sym-25-4 sym-25-5 sym-25-6 sym-25-7 sym-25-8 sym-25-9)
+'(sym-26-0 sym-26-1 sym-26-2 sym-26-3 sym-26-4 sym-26-5 sym-26-6 sym-26-7 sym-26-8 sym-26-9)
+'(sym-27-0 sym-27-1 sym-27-2 sym-27-3 sym-27-4 sym-27-5 sym-27-6 sym-27-7 sym-27-8 sym-27-9)
+'(sym-28-0 sym-28-1 sym-28-2 sym-28-3 sym-28-4 sym-28-5 sym-28-6 sym-28-7 sym-28-8 sym-28-9)
+'(sym-29-0 sym-29-1 sym-29-2 sym-29-3 sym-29-4 sym-29-5 sym-29-6 sym-29-7 sym-29-8 sym-29-9)
+'(sym-30-0 sym-30-1 sym-30-2 sym-30-3 sym-30-4 sym-30-5 sym-30-6 sym-30-7 sym-30-8 sym-30-9)
+'(sym-31-0 sym-31-1 sym-31-2 sym-31-3 sym-31-4 sym-31-5 sym-31-6 sym-31-7 sym-31-8 sym-31-9)
+'(sym-32-0 sym-32-1 sym-32-2 sym-32-3 sym-32-4 sym-32-5 sym-32-6 sym-32-7 sym-32-8 sym-32-9)
+'(sym-33-0 sym-33-1 sym-33-2 sym-33-3 sym-33-4 sym-33-5 sym-33-6 sym-33-7 sym-33-8 sym-33-9)
+'(sym-34-0 sym-34-1 sym-34-2 sym-34-3 sym-34-4 sym-34-5 sym-34-6 sym-34-7 sym-34-8 sym-34-9)
+'(sym-35-0 sym-35-1 sym-35-2 sym-35-3 sym-35-4 sym-35-5 sym-35-6 sym-35-7 sym-35-8 sym-35-9)
+'(sym-36-0 sym-36-1 sym-36-2 sym-36-3 sym-36-4 sym-36-5 sym-36-6 sym-36-7 sym-36-8 sym-36-9)
+'(sym-37-0 sym-37-1 sym-37-2 sym-37-3 sym-37-4 sym-37-5 sym-37-6 sym-37-7 sym-37-8 sym-37-9)
+'(sym-38-0 sym-38-1 sym-38-2 sym-38-3 sym-38-4 sym-38-5 sym-38-6 sym-38-7 sym-38-8 sym-38-9)
+'(sym-39-0 sym-39-1 sym-39-2 sym-39-3 sym-39-4 sym-39-5 sym-39-6 sym-39-7 sym-39-8 sym-39-9)
+'(sym-40-0 sym-40-1 sym-40-2 sym-40-3 sym-40-4 sym-40-5 sym-40-6 sym-40-7 sym-40-8 sym-40-9)
+'(sym-41-0 sym-41-1 sym-41-2 sym-41-3 sym-41-4 sym-41-5 sym-41-6 sym-41-7 sym-41-8 sym-41-9)
+'(sym-42-0 sym-42-1 sym-42-2 sym-42-3 sym-42-4 sym-42-5 sym-42-6 sym-42-7 sym-42-8 sym-42-9)
+'(sym-43-0 sym-43-1 sym-43-2 sym-43-3 sym-43-4 sym-43-5 sym-43-6 sym-43-7 sym-43-8 sym-43-9)
+'(sym-44-0 sym-44-1 sym-44-2 sym-44-3 sym-44-4 sym-44-5 sym-44-6 sym-44-7 sym-44-8 sym-44-9)
+'(sym-45-0 sym-45-1 sym-45-2 sym-45-3 sym-45-4 sym-45-5 sym-45-6 sym-45-7 sym-45-8 sym-45-9)
+'(sym-46-0 sym-46-1 sym-46-2 sym-46-3 sym-46-4 sym-46-5 sym-46-6 sym-46-7 sym-46-8 sym-46-9)
+'(sym-47-0 sym-47-1 sym-47-2 sym-47-3 sym-47-4 sym-47-5 sym-47-6 sym-47-7 sym-47-8 sym-47-9)
+'(sym-48-0 sym-48-1 sym-48-2 sym-48-3 sym-48-4 sym-48-5 sym-48-6 sym-48-7 sym-48-8 sym-48-9)
+'(sym-49-0 sym-49-1 sym-49-2 sym-49-3 sym-49-4 sym-49-5 sym-49-6 sym-49-7 sym-49-8 sym-49-9)
+'(sym-50-0 sym-50-1 sym-50-2 sym-50-3 sym-50-4 sym-50-5 sym-50-6 sym-50-7 sym-50-8 sym-50-9)
+'(sym-51-0 sym-51-1 sym-51-2 sym-51-3 sym-51-4 sym-51-5 sym-51-6 sym-51-7 sym-51-8 sym-51-9)
+'(sym-52-0 sym-52-1 sym-52-2 sym-52-3 sym-52-4 sym-52-5 sym-52-6 sym-52-7 sym-52-8 sym-52-9)
+'(sym-53-0 sym-53-1 sym-53-2 sym-53-3 sym-53-4 sym-53-5 sym-53-6 sym-53-7 sym-53-8 sym-53-9)
+'(sym-54-0 sym-54-1 sym-54-2 sym-54-3 sym-54-4 sym-54-5 sym-54-6 sym-54-7 sym-54-8 sym-54-9)
+'(sym-55-0 sym-55-1 sym-55-2 sym-55-3 sym-55-4 sym-55-5 sym-55-6 sym-55-7 sym-55-8 sym-55-9)
+'(sym-56-0 sym-56-1 sym-56-2 sym-56-3 sym-56-4 sym-56-5 sym-56-6 sym-56-7 sym-56-8 sym-56-9)
+'(sym-57-0 sym-57-1 sym-57-2 sym-57-3 sym-57-4 sym-57-5 sym-57-6 sym-57-7 sym-57-8 sym-57-9)
+'(sym-58-0 sym-58-1 sym-58-2 sym-58-3 sym-58-4 sym-58-5 sym-58-6 sym-58-7 sym-58-8 sym-58-9)
+'(sym-59-0 sym-59-1 sym-59-2 sym-59-3 sym-59-4 sym-59-5 sym-59-6 sym-59-7 sym-59-8 sym-59-9)
+'(sym-60-0 sym-60-1 sym-60-2 sym-60-3 sym-60-4 sym-60-5 sym-60-6 sym-60-7 sym-60-8 sym-60-9)
+'(sym-61-0 sym-61-1 sym-61-2 sym-61-3 sym-61-4 sym-61-5 sym-61-6 sym-61-7 sym-61-8 sym-61-9)
+'(sym-62-0 sym-62-1 sym-62-2 sym-62-3 sym-62-4 sym-62-5 sym-62-6 sym-62-7 sym-62-8 sym-62-9)
+'(sym-63-0 sym-63-1 sym-63-2 sym-63-3 sym-63-4 sym-63-5 sym-63-6 sym-63-7 sym-63-8 sym-63-9)
+'(sym-64-0 sym-64-1 sym-64-2 sym-64-3 sym-64-4 sym-64-5 sym-64-6 sym-64-7 sym-64-8 sym-64-9)
+'(sym-65-0 sym-65-1 sym-65-2 sym-65-3 sym-65-4 sym-65-5 sym-65-6 sym-65-7 sym-65-8 sym-65-9)
+'(sym-66-0 sym-66-1 sym-66-2 sym-66-3 sym-66-4 sym-66-5 sym-66-6 sym-66-7 sym-66-8 sym-66-9)
+'(sym-67-0 sym-67-1 sym-67-2 sym-67-3 sym-67-4 sym-67-5 sym-67-6 sym-67-7 sym-67-8 sym-67-9)
+'(sym-68-0 sym-68-1 sym-68-2 sym-68-3 sym-68-4 sym-68-5 sym-68-6 sym-68-7 sym-68-8 sym-68-9)
+'(sym-69-0 sym-69-1 sym-69-2 sym-69-3 sym-69-4 sym-69-5 sym-69-6 sym-69-7 sym-69-8 sym-69-9)
+'(sym-70-0 sym-70-1 sym-70-2 sym-70-3 sym-70-4 sym-70-5 sym-70-6 sym-70-7 sym-70-8 sym-70-9)
+'(sym-71-0 sym-71-1 sym-71-2 sym-71-3 sym-71-4 sym-71-5 sym-71-6 sym-71-7 sym-71-8 sym-71-9)
+'(sym-72-0 sym-72-1 sym-72-2 sym-72-3 sym-72-4 sym-72-5 sym-72-6 sym-72-7 sym-72-8 sym-72-9)
+'(sym-73-0 sym-73-1 sym-73-2 sym-73-3 sym-73-4 sym-73-5 sym-73-6 sym-73-7 sym-73-8 sym-73-9)
+'(sym-74-0 sym-74-1 sym-74-2 sym-74-3 sym-74-4 sym-74-5 sym-74-6 sym-74-7 sym-74-8 sym-74-9)
+'(sym-75-0 sym-75-1 sym-75-2 sym-75-3 sym-75-4 sym-75-5 sym-75-6 sym-75-7 sym-75-8 sym-75-9)
+'(sym-76-0 sym-76-1 sym-76-2 sym-76-3 sym-76-4 sym-76-5 sym-76-6 sym-76-7 sym-76-8 sym-76-9)
+'(sym-77-0 sym-77-1 sym-77-2 sym-77-3 sym-77-4 sym-77-5 sym-77-6 sym-77-7 sym-77-8 sym-77-9)
+'(sym-78-0 sym-78-1 sym-78-2 sym-78-3 sym-78-4 sym-78-5 sym-78-6 sym-78-7 sym-78-8 sym-78-9)
+'(sym-79-0 sym-79-1 sym-79-2 sym-79-3 sym-79-4 sym-79-5 sym-79-6 sym-79-7 sym-79-8 sym-79-9)
+'(sym-80-0 sym-80-1 sym-80-2 sym-80-3 sym-80-4 sym-80-5 sym-80-6 sym-80-7 sym-80-8 sym-80-9)
+'(sym-81-0 sym-81-1 sym-81-2 sym-81-3 sym-81-4 sym-81-5 sym-81-6 sym-81-7 sym-81-8 sym-81-9)
+'(sym-82-0 sym-82-1 sym-82-2 sym-82-3 sym-82-4 sym-82-5 sym-82-6 sym-82-7 sym-82-8 sym-82-9)
+'(sym-83-0 sym-83-1 sym-83-2 sym-83-3 sym-83-4 sym-83-5 sym-83-6 sym-83-7 sym-83-8 sym-83-9)
+'(sym-84-0 sym-84-1 sym-84-2 sym-84-3 sym-84-4 sym-84-5 sym-84-6 sym-84-7 sym-84-8 sym-84-9)
+'(sym-85-0 sym-85-1 sym-85-2 sym-85-3 sym-85-4 sym-85-5 sym-85-6 sym-85-7 sym-85-8 sym-85-9)
+'(sym-86-0 sym-86-1 sym-86-2 sym-86-3 sym-86-4 sym-86-5 sym-86-6 sym-86-7 sym-86-8 sym-86-9)
+'(sym-87-0 sym-87-1 sym-87-2 sym-87-3 sym-87-4 sym-87-5 sym-87-6 sym-87-7 sym-87-8 sym-87-9)
+'(sym-88-0 sym-88-1 sym-88-2 sym-88-3 sym-88-4 sym-88-5 sym-88-6 sym-88-7 sym-88-8 sym-88-9)
+'(sym-89-0 sym-89-1 sym-89-2 sym-89-3 sym-89-4 sym-89-5 sym-89-6 sym-89-7 sym-89-8 sym-89-9)
+'(sym-90-0 sym-90-1 sym-90-2 sym-90-3 sym-90-4 sym-90-5 sym-90-6 sym-90-7 sym-90-8 sym-90-9)
+'(sym-91-0 sym-91-1 sym-91-2 sym-91-3 sym-91-4 sym-91-5 sym-91-6 sym-91-7 sym-91-8 sym-91-9)
+'(sym-92-0 sym-92-1 sym-92-2 sym-92-3 sym-92-4 sym-92-5 sym-92-6 sym-92-7 sym-92-8 sym-92-9)
+'(sym-93-0 sym-93-1 sym-93-2 sym-93-3 sym-93-4 sym-93-5 sym-93-6 sym-93-7 sym-93-8 sym-93-9)
+'(sym-94-0 sym-94-1 sym-94-2 sym-94-3 sym-94-4 sym-94-5 sym-94-6 sym-94-7 sym-94-8 sym-94-9)
+'(sym-95-0 sym-95-1 sym-95-2 sym-95-3 sym-95-4 sym-95-5 sym-95-6 sym-95-7 sym-95-8 sym-95-9)
+'(sym-96-0 sym-96-1 sym-96-2 sym-96-3 sym-96-4 sym-96-5 sym-96-6 sym-96-7 sym-96-8 sym-96-9)
+'(sym-97-0 sym-97-1 sym-97-2 sym-97-3 sym-97-4 sym-97-5 sym-97-6 sym-97-7 sym-97-8 sym-97-9)
+'(sym-98-0 sym-98-1 sym-98-2 sym-98-3 sym-98-4 sym-98-5 sym-98-6 sym-98-7 sym-98-8 sym-98-9)
+'(sym-99-0 sym-99-1 sym-99-2 sym-99-3 sym-99-4 sym-99-5 sym-99-6 sym-99-7 sym-99-8 sym-99-9)
+'(sym-100-0 sym-100-1 sym-100-2 sym-100-3 sym-100-4 sym-100-5 sym-100-6 sym-100-7 sym-100-8 sym-100-9)
+'(sym-101-0 sym-101-1 sym-101-2 sym-101-3 sym-101-4 sym-101-5 sym-101-6 sym-101-7 sym-101-8 sym-101-9)
+'(sym-102-0 sym-102-1 sym-102-2 sym-102-3 sym-102-4 sym-102-5 sym-102-6 sym-102-7 sym-102-8 sym-102-9)
+'(sym-103-0 sym-103-1 sym-103-2 sym-103-3 sym-103-4 sym-103-5 sym-103-6 sym-103-7 sym-103-8 sym-103-9)
+'(sym-104-0 sym-104-1 sym-104-2 sym-104-3 sym-104-4 sym-104-5 sym-104-6 sym-104-7 sym-104-8 sym-104-9)
+'(sym-105-0 sym-105-1 sym-105-2 sym-105-3 sym-105-4 sym-105-5 sym-105-6 sym-105-7 sym-105-8 sym-105-9)
+'(sym-106-0 sym-106-1 sym-106-2 sym-106-3 sym-106-4 sym-106-5 sym-106-6 sym-106-7 sym-106-8 sym-106-9)
+'(sym-107-0 sym-107-1 sym-107-2 sym-107-3 sym-107-4 sym-107-5 sym-107-6 sym-107-7 sym-107-8 sym-107-9)
+'(sym-108-0 sym-108-1 sym-108-2 sym-108-3 sym-108-4 sym-108-5 sym-108-6 sym-108-7 sym-108-8 sym-108-9)
+'(sym-109-0 sym-109-1 sym-109-2 sym-109-3 sym-109-4 sym-109-5 sym-109-6 sym-109-7 sym-109-8 sym-109-9)
+'(sym-110-0 sym-110-1 sym-110-2 sym-110-3 sym-110-4 sym-110-5 sym-110-6 sym-110-7 sym-110-8 sym-110-9)
+'(sym-111-0 sym-111-1 sym-111-2 sym-111-3 sym-111-4 sym-111-5 sym-111-6 sym-111-7 sym-111-8 sym-111-9)
+'(sym-112-0 sym-112-1 sym-112-2 sym-112-3 sym-112-4 sym-112-5 sym-112-6 sym-112-7 sym-112-8 sym-112-9)
+'(sym-113-0 sym-113-1 sym-113-2 sym-113-3 sym-113-4 sym-113-5 sym-113-6 sym-113-7 sym-113-8 sym-113-9)
+'(sym-114-0 sym-114-1 sym-114-2 sym-114-3 sym-114-4 sym-114-5 sym-114-6 sym-114-7 sym-114-8 sym-114-9)
+'(sym-115-0 sym-115-1 sym-115-2 sym-115-3 sym-115-4 sym-115-5 sym-115-6 sym-115-7 sym-115-8 sym-115-9)
+'(sym-116-0 sym-116-1 sym-116-2 sym-116-3 sym-116-4 sym-116-5 sym-116-6 sym-116-7 sym-116-8 sym-116-9)
+'(sym-117-0 sym-117-1 sym-117-2 sym-117-3 sym-117-4 sym-117-5 sym-117-6 sym-117-7 sym-117-8 sym-117-9)
+'(sym-118-0 sym-118-1 sym-118-2 sym-118-3 sym-118-4 sym-118-5 sym-118-6 sym-118-7 sym-118-8 sym-118-9)
+'(sym-119-0 sym-119-1 sym-119-2 sym-119-3 sym-119-4 sym-119-5 sym-119-6 sym-119-7 sym-119-8 sym-119-9)
+'(sym-120-0 sym-120-1 sym-120-2 sym-120-3 sym-120-4 sym-120-5 sym-120-6 sym-120-7 sym-120-8 sym-120-9)
+'(sym-121-0 sym-121-1 sym-121-2 sym-121-3 sym-121-4 sym-121-5 sym-121-6 sym-121-7 sym-121-8 sym-121-9)
+'(sym-122-0 sym-122-1 sym-122-2 sym-122-3 sym-122-4 sym-122-5 sym-122-6 sym-122-7 sym-122-8 sym-122-9)
+'(sym-123-0 sym-123-1 sym-123-2 sym-123-3 sym-123-4 sym-123-5 sym-123-6 sym-123-7 sym-123-8 sym-123-9)
+'(sym-124-0 sym-124-1 sym-124-2 sym-124-3 sym-124-4 sym-124-5 sym-124-6 sym-124-7 sym-124-8 sym-124-9)
+'(sym-125-0 sym-125-1 sym-125-2 sym-125-3 sym-125-4 sym-125-5 sym-125-6 sym-125-7 sym-125-8 sym-125-9)
+'(sym-126-0 sym-126-1 sym-126-2 sym-126-3 sym-126-4 sym-126-5 sym-126-6 sym-126-7 sym-126-8 sym-126-9)
+'(sym-127-0 sym-127-1 sym-127-2 sym-127-3 sym-127-4 sym-127-5 sym-127-6 sym-127-7 sym-127-8 sym-127-9)
+'(sym-128-0 sym-128-1 sym-128-2 sym-128-3 sym-128-4 sym-128-5 sym-128-6 sym-128-7 sym-128-8 sym-128-9)
+'(sym-129-0 sym-129-1 sym-129-2 sym-129-3 sym-129-4 sym-129-5 sym-129-6 sym-129-7 sym-129-8 sym-129-9)
+'(sym-130-0 sym-130-1 sym-130-2 sym-130-3 sym-130-4 sym-130-5 sym-130-6 sym-130-7 sym-130-8 sym-130-9)
+'(sym-131-0 sym-131-1 sym-131-2 sym-131-3 sym-131-4 sym-131-5 sym-131-6 sym-131-7 sym-131-8 sym-131-9)
+'(sym-132-0 sym-132-1 sym-132-2 sym-132-3 sym-132-4 sym-132-5 sym-132-6 sym-132-7 sym-132-8 sym-132-9)
+'(sym-133-0 sym-133-1 sym-133-2 sym-133-3 sym-133-4 sym-133-5 sym-133-6 sym-133-7 sym-133-8 sym-133-9)
+'(sym-134-0 sym-134-1 sym-134-2 sym-134-3 sym-134-4 sym-134-5 sym-134-6 sym-134-7 sym-134-8 sym-134-9)
+'(sym-135-0 sym-135-1 sym-135-2 sym-135-3 sym-135-4 sym-135-5 sym-135-6 sym-135-7 sym-135-8 sym-135-9)
+'(sym-136-0 sym-136-1 sym-136-2 sym-136-3 sym-136-4 sym-136-5 sym-136-6 sym-136-7 sym-136-8 sym-136-9)
+'(sym-137-0 sym-137-1 sym-137-2 sym-137-3 sym-137-4 sym-137-5 sym-137-6 sym-137-7 sym-137-8 sym-137-9)
+'(sym-138-0 sym-138-1 sym-138-2 sym-138-3 sym-138-4 sym-138-5 sym-138-6 sym-138-7 sym-138-8 sym-138-9)
+'(sym-139-0 sym-139-1 sym-139-2 sym-139-3 sym-139-4 sym-139-5 sym-139-6 sym-139-7 sym-139-8 sym-139-9)
+'(sym-140-0 sym-140-1 sym-140-2 sym-140-3 sym-140-4 sym-140-5 sym-140-6 sym-140-7 sym-140-8 sym-140-9)
+'(sym-141-0 sym-141-1 sym-141-2 sym-141-3 sym-141-4 sym-141-5 sym-141-6 sym-141-7 sym-141-8 sym-141-9)
+'(sym-142-0 sym-142-1 sym-142-2 sym-142-3 sym-142-4 sym-142-5 sym-142-6 sym-142-7 sym-142-8 sym-142-9)
+'(sym-143-0 sym-143-1 sym-143-2 sym-143-3 sym-143-4 sym-143-5 sym-143-6 sym-143-7 sym-143-8 sym-143-9)
+'(sym-144-0 sym-144-1 sym-144-2 sym-144-3 sym-144-4 sym-144-5 sym-144-6 sym-144-7 sym-144-8 sym-144-9)
+'(sym-145-0 sym-145-1 sym-145-2 sym-145-3 sym-145-4 sym-145-5 sym-145-6 sym-145-7 sym-145-8 sym-145-9)
+'(sym-146-0 sym-146-1 sym-146-2 sym-146-3 sym-146-4 sym-146-5 sym-146-6 sym-146-7 sym-146-8 sym-146-9)
+'(sym-147-0 sym-147-1 sym-147-2 sym-147-3 sym-147-4 sym-147-5 sym-147-6 sym-147-7 sym-147-8 sym-147-9)
+'(sym-148-0 sym-148-1 sym-148-2 sym-148-3 sym-148-4 sym-148-5 sym-148-6 sym-148-7 sym-148-8 sym-148-9)
+'(sym-149-0 sym-149-1 sym-149-2 sym-149-3 sym-149-4 sym-149-5 sym-149-6 sym-149-7 sym-149-8 sym-149-9)
+'(sym-150-0 sym-150-1 sym-150-2 sym-150-3 sym-150-4 sym-150-5 sym-150-6 sym-150-7 sym-150-8 sym-150-9)
+'(sym-151-0 sym-151-1 sym-151-2 sym-151-3 sym-151-4 sym-151-5 sym-151-6 sym-151-7 sym-151-8 sym-151-9)
+'(sym-152-0 sym-152-1 sym-152-2 sym-152-3 sym-152-4 sym-152-5 sym-152-6 sym-152-7 sym-152-8 sym-152-9)
+'(sym-153-0 sym-153-1 sym-153-2 sym-153-3 sym-153-4 sym-153-5 sym-153-6 sym-153-7 sym-153-8 sym-153-9)
+'(sym-154-0 sym-154-1 sym-154-2 sym-154-3 sym-154-4 sym-154-5 sym-154-6 sym-154-7 sym-154-8 sym-154-9)
+'(sym-155-0 sym-155-1 sym-155-2 sym-155-3 sym-155-4 sym-155-5 sym-155-6 sym-155-7 sym-155-8 sym-155-9)
+'(sym-156-0 sym-156-1 sym-156-2 sym-156-3 sym-156-4 sym-156-5 sym-156-6 sym-156-7 sym-156-8 sym-156-9)
+'(sym-157-0 sym-157-1 sym-157-2 sym-157-3 sym-157-4 sym-157-5 sym-157-6 sym-157-7 sym-157-8 sym-157-9)
+'(sym-158-0 sym-158-1 sym-158-2 sym-158-3 sym-158-4 sym-158-5 sym-158-6 sym-158-7 sym-158-8 sym-158-9)
+'(sym-159-0 sym-159-1 sym-159-2 sym-159-3 sym-159-4 sym-159-5 sym-159-6 sym-159-7 sym-159-8 sym-159-9)
+'(sym-160-0 sym-160-1 sym-160-2 sym-160-3 sym-160-4 sym-160-5 sym-160-6 sym-160-7 sym-160-8 sym-160-9)
+'(sym-161-0 sym-161-1 sym-161-2 sym-161-3 sym-161-4 sym-161-5 sym-161-6 sym-161-7 sym-161-8 sym-161-9)
+'(sym-162-0 sym-162-1 sym-162-2 sym-162-3 sym-162-4 sym-162-5 sym-162-6 sym-162-7 sym-162-8 sym-162-9)
+'(sym-163-0 sym-163-1 sym-163-2 sym-163-3 sym-163-4 sym-163-5 sym-163-6 sym-163-7 sym-163-8 sym-163-9)
+'(sym-164-0 sym-164-1 sym-164-2 sym-164-3 sym-164-4 sym-164-5 sym-164-6 sym-164-7 sym-164-8 sym-164-9)
+'(sym-165-0 sym-165-1 sym-165-2 sym-165-3 sym-165-4 sym-165-5 sym-165-6 sym-165-7 sym-165-8 sym-165-9)
+'(sym-166-0 sym-166-1 sym-166-2 sym-166-3 sym-166-4 sym-166-5 sym-166-6 sym-166-7 sym-166-8 sym-166-9)
+'(sym-167-0 sym-167-1 sym-167-2 sym-167-3 sym-167-4 sym-167-5 sym-167-6 sym-167-7 sym-167-8 sym-167-9)
+'(sym-168-0 sym-168-1 sym-168-2 sym-168-3 sym-168-4 sym-168-5 sym-168-6 sym-168-7 sym-168-8 sym-168-9)
+'(sym-169-0 sym-169-1 sym-169-2 sym-169-3 sym-169-4 sym-169-5 sym-169-6 sym-169-7 sym-169-8 sym-169-9)
+'(sym-170-0 sym-170-1 sym-170-2 sym-170-3 sym-170-4 sym-170-5 sym-170-6 sym-170-7 sym-170-8 sym-170-9)
+'(sym-171-0 sym-171-1 sym-171-2 sym-171-3 sym-171-4 sym-171-5 sym-171-6 sym-171-7 sym-171-8 sym-171-9)
+'(sym-172-0 sym-172-1 sym-172-2 sym-172-3 sym-172-4 sym-172-5 sym-172-6 sym-172-7 sym-172-8 sym-172-9)
+'(sym-173-0 sym-173-1 sym-173-2 sym-173-3 sym-173-4 sym-173-5 sym-173-6 sym-173-7 sym-173-8 sym-173-9)
+'(sym-174-0 sym-174-1 sym-174-2 sym-174-3 sym-174-4 sym-174-5 sym-174-6 sym-174-7 sym-174-8 sym-174-9)
+'(sym-175-0 sym-175-1 sym-175-2 sym-175-3 sym-175-4 sym-175-5 sym-175-6 sym-175-7 sym-175-8 sym-175-9)
+'(sym-176-0 sym-176-1 sym-176-2 sym-176-3 sym-176-4 sym-176-5 sym-176-6 sym-176-7 sym-176-8 sym-176-9)
+'(sym-177-0 sym-177-1 sym-177-2 sym-177-3 sym-177-4 sym-177-5 sym-177-6 sym-177-7 sym-177-8 sym-177-9)
+'(sym-178-0 sym-178-1 sym-178-2 sym-178-3 sym-178-4 sym-178-5 sym-178-6 sym-178-7 sym-178-8 sym-178-9)
+'(sym-179-0 sym-179-1 sym-179-2 sym-179-3 sym-179-4 sym-179-5 sym-179-6 sym-179-7 sym-179-8 sym-179-9)
+'(sym-180-0 sym-180-1 sym-180-2 sym-180-3 sym-180-4 sym-180-5 sym-180-6 sym-180-7 sym-180-8 sym-180-9)
+'(sym-181-0 sym-181-1 sym-181-2 sym-181-3 sym-181-4 sym-181-5 sym-181-6 sym-181-7 sym-181-8 sym-181-9)
+'(sym-182-0 sym-182-1 sym-182-2 sym-182-3 sym-182-4 sym-182-5 sym-182-6 sym-182-7 sym-182-8 sym-182-9)
+'(sym-183-0 sym-183-1 sym-183-2 sym-183-3 sym-183-4 sym-183-5 sym-183-6 sym-183-7 sym-183-8 sym-183-9)
+'(sym-184-0 sym-184-1 sym-184-2 sym-184-3 sym-184-4 sym-184-5 sym-184-6 sym-184-7 sym-184-8 sym-184-9)
+'(sym-185-0 sym-185-1 sym-185-2 sym-185-3 sym-185-4 sym-185-5 sym-185-6 sym-185-7 sym-185-8 sym-185-9)
+'(sym-186-0 sym-186-1 sym-186-2 sym-186-3 sym-186-4 sym-186-5 sym-186-6 sym-186-7 sym-186-8 sym-186-9)
+'(sym-187-0 sym-187-1 sym-187-2 sym-187-3 sym-187-4 sym-187-5 sym-187-6 sym-187-7 sym-187-8 sym-187-9)
+'(sym-188-0 sym-188-1 sym-188-2 sym-188-3 sym-188-4 sym-188-5 sym-188-6 sym-188-7 sym-188-8 sym-188-9)
+'(sym-189-0 sym-189-1 sym-189-2 sym-189-3 sym-189-4 sym-189-5 sym-189-6 sym-189-7 sym-189-8 sym-189-9)
+'(sym-190-0 sym-190-1 sym-190-2 sym-190-3 sym-190-4 sym-190-5 sym-190-6 sym-190-7 sym-190-8 sym-190-9)
+'(sym-191-0 sym-191-1 sym-191-2 sym-191-3 sym-191-4 sym-191-5 sym-191-6 sym-191-7 sym-191-8 sym-191-9)
+'(sym-192-0 sym-192-1 sym-192-2 sym-192-3 sym-192-4 sym-192-5 sym-192-6 sym-192-7 sym-192-8 sym-192-9)
+'(sym-193-0 sym-193-1 sym-193-2 sym-193-3 sym-193-4 sym-193-5 sym-193-6 sym-193-7 sym-193-8 sym-193-9)
+'(sym-194-0 sym-194-1 sym-194-2 sym-194-3 sym-194-4 sym-194-5 sym-194-6 sym-194-7 sym-194-8 sym-194-9)
+'(sym-195-0 sym-195-1 sym-195-2 sym-195-3 sym-195-4 sym-195-5 sym-195-6 sym-195-7 sym-195-8 sym-195-9)
+'(sym-196-0 sym-196-1 sym-196-2 sym-196-3 sym-196-4 sym-196-5 sym-196-6 sym-196-7 sym-196-8 sym-196-9)
+'(sym-197-0 sym-197-1 sym-197-2 sym-197-3 sym-197-4 sym-197-5 sym-197-6 sym-197-7 sym-197-8 sym-197-9)
+'(sym-198-0 sym-198-1 sym-198-2 sym-198-3 sym-198-4 sym-198-5 sym-198-6 sym-198-7 sym-198-8 sym-198-9)
+'(sym-199-0 sym-199-1 sym-199-2 sym-199-3 sym-199-4 sym-199-5 sym-199-6 sym-199-7 sym-199-8 sym-199-9)
+'(sym-200-0 sym-200-1 sym-200-2 sym-200-3 sym-200-4 sym-200-5 sym-200-6 sym-200-7 sym-200-8 sym-200-9)
+'(sym-201-0 sym-201-1 sym-201-2 sym-201-3 sym-201-4 sym-201-5 sym-201-6 sym-201-7 sym-201-8 sym-201-9)
+'(sym-202-0 sym-202-1 sym-202-2 sym-202-3 sym-202-4 sym-202-5 sym-202-6 sym-202-7 sym-202-8 sym-202-9)
+'(sym-203-0 sym-203-1 sym-203-2 sym-203-3 sym-203-4 sym-203-5 sym-203-6 sym-203-7 sym-203-8 sym-203-9)
+'(sym-204-0 sym-204-1 sym-204-2 sym-204-3 sym-204-4 sym-204-5 sym-204-6 sym-204-7 sym-204-8 sym-204-9)
+'(sym-205-0 sym-205-1 sym-205-2 sym-205-3 sym-205-4 sym-205-5 sym-205-6 sym-205-7 sym-205-8 sym-205-9)
+'(sym-206-0 sym-206-1 sym-206-2 sym-206-3 sym-206-4 sym-206-5 sym-206-6 sym-206-7 sym-206-8 sym-206-9)
+'(sym-207-0 sym-207-1 sym-207-2 sym-207-3 sym-207-4 sym-207-5 sym-207-6 sym-207-7 sym-207-8 sym-207-9)
+'(sym-208-0 sym-208-1 sym-208-2 sym-208-3 sym-208-4 sym-208-5 sym-208-6 sym-208-7 sym-208-8 sym-208-9)
+'(sym-209-0 sym-209-1 sym-209-2 sym-209-3 sym-209-4 sym-209-5 sym-209-6 sym-209-7 sym-209-8 sym-209-9)
+'(sym-210-0 sym-210-1 sym-210-2 sym-210-3 sym-210-4 sym-210-5 sym-210-6 sym-210-7 sym-210-8 sym-210-9)
+'(sym-211-0 sym-211-1 sym-211-2 sym-211-3 sym-211-4 sym-211-5 sym-211-6 sym-211-7 sym-211-8 sym-211-9)
+'(sym-212-0 sym-212-1 sym-212-2 sym-212-3 sym-212-4 sym-212-5 sym-212-6 sym-212-7 sym-212-8 sym-212-9)
+'(sym-213-0 sym-213-1 sym-213-2 sym-213-3 sym-213-4 sym-213-5 sym-213-6 sym-213-7 sym-213-8 sym-213-9)
+'(sym-214-0 sym-214-1 sym-214-2 sym-214-3 sym-214-4 sym-214-5 sym-214-6 sym-214-7 sym-214-8 sym-214-9)
+'(sym-215-0 sym-215-1 sym-215-2 sym-215-3 sym-215-4 sym-215-5 sym-215-6 sym-215-7 sym-215-8 sym-215-9)
+'(sym-216-0 sym-216-1 sym-216-2 sym-216-3 sym-216-4 sym-216-5 sym-216-6 sym-216-7 sym-216-8 sym-216-9)
+'(sym-217-0 sym-217-1 sym-217-2 sym-217-3 sym-217-4 sym-217-5 sym-217-6 sym-217-7 sym-217-8 sym-217-9)
+'(sym-218-0 sym-218-1 sym-218-2 sym-218-3 sym-218-4 sym-218-5 sym-218-6 sym-218-7 sym-218-8 sym-218-9)
+'(sym-219-0 sym-219-1 sym-219-2 sym-219-3 sym-219-4 sym-219-5 sym-219-6 sym-219-7 sym-219-8 sym-219-9)
+'(sym-220-0 sym-220-1 sym-220-2 sym-220-3 sym-220-4 sym-220-5 sym-220-6 sym-220-7 sym-220-8 sym-220-9)
+'(sym-221-0 sym-221-1 sym-221-2 sym-221-3 sym-221-4 sym-221-5 sym-221-6 sym-221-7 sym-221-8 sym-221-9)
+'(sym-222-0 sym-222-1 sym-222-2 sym-222-3 sym-222-4 sym-222-5 sym-222-6 sym-222-7 sym-222-8 sym-222-9)
+'(sym-223-0 sym-223-1 sym-223-2 sym-223-3 sym-223-4 sym-223-5 sym-223-6 sym-223-7 sym-223-8 sym-223-9)
+'(sym-224-0 sym-224-1 sym-224-2 sym-224-3 sym-224-4 sym-224-5 sym-224-6 sym-224-7 sym-224-8 sym-224-9)
+'(sym-225-0 sym-225-1 sym-225-2 sym-225-3 sym-225-4 sym-225-5 sym-225-6 sym-225-7 sym-225-8 sym-225-9)
+'(sym-226-0 sym-226-1 sym-226-2 sym-226-3 sym-226-4 sym-226-5 sym-226-6 sym-226-7 sym-226-8 sym-226-9)
+'(sym-227-0 sym-227-1 sym-227-2 sym-227-3 sym-227-4 sym-227-5 sym-227-6 sym-227-7 sym-227-8 sym-227-9)
+'(sym-228-0 sym-228-1 sym-228-2 sym-228-3 sym-228-4 sym-228-5 sym-228-6 sym-228-7 sym-228-8 sym-228-9)
+'(sym-229-0 sym-229-1 sym-229-2 sym-229-3 sym-229-4 sym-229-5 sym-229-6 sym-229-7 sym-229-8 sym-229-9)
+'(sym-230-0 sym-230-1 sym-230-2 sym-230-3 sym-230-4 sym-230-5 sym-230-6 sym-230-7 sym-230-8 sym-230-9)
+'(sym-231-0 sym-231-1 sym-231-2 sym-231-3 sym-231-4 sym-231-5 sym-231-6 sym-231-7 sym-231-8 sym-231-9)
+'(sym-232-0 sym-232-1 sym-232-2 sym-232-3 sym-232-4 sym-232-5 sym-232-6 sym-232-7 sym-232-8 sym-232-9)
+'(sym-233-0 sym-233-1 sym-233-2 sym-233-3 sym-233-4 sym-233-5 sym-233-6 sym-233-7 sym-233-8 sym-233-9)
+'(sym-234-0 sym-234-1 sym-234-2 sym-234-3 sym-234-4 sym-234-5 sym-234-6 sym-234-7 sym-234-8 sym-234-9)
+'(sym-235-0 sym-235-1 sym-235-2 sym-235-3 sym-235-4 sym-235-5 sym-235-6 sym-235-7 sym-235-8 sym-235-9)
+'(sym-236-0 sym-236-1 sym-236-2 sym-236-3 sym-236-4 sym-236-5 sym-236-6 sym-236-7 sym-236-8 sym-236-9)
+'(sym-237-0 sym-237-1 sym-237-2 sym-237-3 sym-237-4 sym-237-5 sym-237-6 sym-237-7 sym-237-8 sym-237-9)
+'(sym-238-0 sym-238-1 sym-238-2 sym-238-3 sym-238-4 sym-238-5 sym-238-6 sym-238-7 sym-238-8 sym-238-9)
+'(sym-239-0 sym-239-1 sym-239-2 sym-239-3 sym-239-4 sym-239-5 sym-239-6 sym-239-7 sym-239-8 sym-239-9)
+'(sym-240-0 sym-240-1 sym-240-2 sym-240-3 sym-240-4 sym-240-5 sym-240-6 sym-240-7 sym-240-8 sym-240-9)
+'(sym-241-0 sym-241-1 sym-241-2 sym-241-3 sym-241-4 sym-241-5 sym-241-6 sym-241-7 sym-241-8 sym-241-9)
+'(sym-242-0 sym-242-1 sym-242-2 sym-242-3 sym-242-4 sym-242-5 sym-242-6 sym-242-7 sym-242-8 sym-242-9)
+'(sym-243-0 sym-243-1 sym-243-2 sym-243-3 sym-243-4 sym-243-5 sym-243-6 sym-243-7 sym-243-8 sym-243-9)
+'(sym-244-0 sym-244-1 sym-244-2 sym-244-3 sym-244-4 sym-244-5 sym-244-6 sym-244-7 sym-244-8 sym-244-9)
+'(sym-245-0 sym-245-1 sym-245-2 sym-245-3 sym-245-4 sym-245-5 sym-245-6 sym-245-7 sym-245-8 sym-245-9)
+'(sym-246-0 sym-246-1 sym-246-2 sym-246-3 sym-246-4 sym-246-5 sym-246-6 sym-246-7 sym-246-8 sym-246-9)
+'(sym-247-0 sym-247-1 sym-247-2 sym-247-3 sym-247-4 sym-247-5 sym-247-6 sym-247-7 sym-247-8 sym-247-9)
+'(sym-248-0 sym-248-1 sym-248-2 sym-248-3 sym-248-4 sym-248-5 sym-248-6 sym-248-7 sym-248-8 sym-248-9)
+'(sym-249-0 sym-249-1 sym-249-2 sym-249-3 sym-249-4 sym-249-5 sym-249-6 sym-249-7 sym-249-8 sym-249-9)
+'(sym-250-0 sym-250-1 sym-250-2 sym-250-3 sym-250-4 sym-250-5 sym-250-6 sym-250-7 sym-250-8 sym-250-9)
+'(sym-251-0 sym-251-1 sym-251-2 sym-251-3 sym-251-4 sym-251-5 sym-251-6 sym-251-7 sym-251-8 sym-251-9)
+'(sym-252-0 sym-252-1 sym-252-2 sym-252-3 sym-252-4 sym-252-5 sym-252-6 sym-252-7 sym-252-8 sym-252-9)
+'(sym-253-0 sym-253-1 sym-253-2 sym-253-3 sym-253-4 sym-253-5 sym-253-6 sym-253-7 sym-253-8 sym-253-9)
+'(sym-254-0 sym-254-1 sym-254-2 sym-254-3 sym-254-4 sym-254-5 sym-254-6 sym-254-7 sym-254-8 sym-254-9)
+'(sym-255-0 sym-255-1 sym-255-2 sym-255-3 sym-255-4 sym-255-5 sym-255-6 sym-255-7 sym-255-8 sym-255-9)
+'(sym-256-0 sym-256-1 sym-256-2 sym-256-3 sym-256-4 sym-256-5 sym-256-6 sym-256-7 sym-256-8 sym-256-9)
+'(sym-257-0 sym-257-1 sym-257-2 sym-257-3 sym-257-4 sym-257-5 sym-257-6 sym-257-7 sym-257-8 sym-257-9)
+'(sym-258-0 sym-258-1 sym-258-2 sym-258-3 sym-258-4 sym-258-5 sym-258-6 sym-258-7 sym-258-8 sym-258-9)
+'(sym-259-0 sym-259-1 sym-259-2 sym-259-3 sym-259-4 sym-259-5 sym-259-6 sym-259-7 sym-259-8 sym-259-9)
+'(sym-260-0 sym-260-1 sym-260-2 sym-260-3 sym-260-4 sym-260-5 sym-260-6 sym-260-7 sym-260-8 sym-260-9)
+'(sym-261-0 sym-261-1 sym-261-2 sym-261-3 sym-261-4 sym-261-5 sym-261-6 sym-261-7 sym-261-8 sym-261-9)
+'(sym-262-0 sym-262-1 sym-262-2 sym-262-3 sym-262-4 sym-262-5 sym-262-6 sym-262-7 sym-262-8 sym-262-9)
+'(sym-263-0 sym-263-1 sym-263-2 sym-263-3 sym-263-4 sym-263-5 sym-263-6 sym-263-7 sym-263-8 sym-263-9)
+'(sym-264-0 sym-264-1 sym-264-2 sym-264-3 sym-264-4 sym-264-5 sym-264-6 sym-264-7 sym-264-8 sym-264-9)
+'(sym-265-0 sym-265-1 sym-265-2 sym-265-3 sym-265-4 sym-265-5 sym-265-6 sym-265-7 sym-265-8 sym-265-9)
+'(sym-266-0 sym-266-1 sym-266-2 sym-266-3 sym-266-4 sym-266-5 sym-266-6 sym-266-7 sym-266-8 sym-266-9)
+'(sym-267-0 sym-267-1 sym-267-2 sym-267-3 sym-267-4 sym-267-5 sym-267-6 sym-267-7 sym-267-8 sym-267-9)
+'(sym-268-0 sym-268-1 sym-268-2 sym-268-3 sym-268-4 sym-268-5 sym-268-6 sym-268-7 sym-268-8 sym-268-9)
+'(sym-269-0 sym-269-1 sym-269-2 sym-269-3 sym-269-4 sym-269-5 sym-269-6 sym-269-7 sym-269-8 sym-269-9)
+'(sym-270-0 sym-270-1 sym-270-2 sym-270-3 sym-270-4 sym-270-5 sym-270-6 sym-270-7 sym-270-8 sym-270-9)
+'(sym-271-0 sym-271-1 sym-271-2 sym-271-3 sym-271-4 sym-271-5 sym-271-6 sym-271-7 sym-271-8 sym-271-9)
+'(sym-272-0 sym-272-1 sym-272-2 sym-272-3 sym-272-4 sym-272-5 sym-272-6 sym-272-7 sym-272-8 sym-272-9)
+'(sym-273-0 sym-273-1 sym-273-2 sym-273-3 sym-273-4 sym-273-5 sym-273-6 sym-273-7 sym-273-8 sym-273-9)
+'(sym-274-0 sym-274-1 sym-274-2 sym-274-3 sym-274-4 sym-274-5 sym-274-6 sym-274-7 sym-274-8 sym-274-9)
+'(sym-275-0 sym-275-1 sym-275-2 sym-275-3 sym-275-4 sym-275-5 sym-275-6 sym-275-7 sym-275-8 sym-275-9)
+'(sym-276-0 sym-276-1 sym-276-2 sym-276-3 sym-276-4 sym-276-5 sym-276-6 sym-276-7 sym-276-8 sym-276-9)
+'(sym-277-0 sym-277-1 sym-277-2 sym-277-3 sym-277-4 sym-277-5 sym-277-6 sym-277-7 sym-277-8 sym-277-9)
+'(sym-278-0 sym-278-1 sym-278-2 sym-278-3 sym-278-4 sym-278-5 sym-278-6 sym-278-7 sym-278-8 sym-278-9)
+'(sym-279-0 sym-279-1 sym-279-2 sym-279-3 sym-279-4 sym-279-5 sym-279-6 sym-279-7 sym-279-8 sym-279-9)
+'(sym-280-0 sym-280-1 sym-280-2 sym-280-3 sym-280-4 sym-280-5 sym-280-6 sym-280-7 sym-280-8 sym-280-9)
+'(sym-281-0 sym-281-1 sym-281-2 sym-281-3 sym-281-4 sym-281-5 sym-281-6 sym-281-7 sym-281-8 sym-281-9)
+'(sym-282-0 sym-282-1 sym-282-2 sym-282-3 sym-282-4 sym-282-5 sym-282-6 sym-282-7 sym-282-8 sym-282-9)
+'(sym-283-0 sym-283-1 sym-283-2 sym-283-3 sym-283-4 sym-283-5 sym-283-6 sym-283-7 sym-283-8 sym-283-9)
+'(sym-284-0 sym-284-1 sym-284-2 sym-284-3 sym-284-4 sym-284-5 sym-284-6 sym-284-7 sym-284-8 sym-284-9)
+'(sym-285-0 sym-285-1 sym-285-2 sym-285-3 sym-285-4 sym-285-5 sym-285-6 sym-285-7 sym-285-8 sym-285-9)
+'(sym-286-0 sym-286-1 sym-286-2 sym-286-3 sym-286-4 sym-286-5 sym-286-6 sym-286-7 sym-286-8 sym-286-9)
+'(sym-287-0 sym-287-1 sym-287-2 sym-287-3 sym-287-4 sym-287-5 sym-287-6 sym-287-7 sym-287-8 sym-287-9)
+'(sym-288-0 sym-288-1 sym-288-2 sym-288-3 sym-288-4 sym-288-5 sym-288-6 sym-288-7 sym-288-8 sym-288-9)
+'(sym-289-0 sym-289-1 sym-289-2 sym-289-3 sym-289-4 sym-289-5 sym-289-6 sym-289-7 sym-289-8 sym-289-9)
+'(sym-290-0 sym-290-1 sym-290-2 sym-290-3 sym-290-4 sym-290-5 sym-290-6 sym-290-7 sym-290-8 sym-290-9)
+'(sym-291-0 sym-291-1 sym-291-2 sym-291-3 sym-291-4 sym-291-5 sym-291-6 sym-291-7 sym-291-8 sym-291-9)
+'(sym-292-0 sym-292-1 sym-292-2 sym-292-3 sym-292-4 sym-292-5 sym-292-6 sym-292-7 sym-292-8 sym-292-9)
+'(sym-293-0 sym-293-1 sym-293-2 sym-293-3 sym-293-4 sym-293-5 sym-293-6 sym-293-7 sym-293-8 sym-293-9)
+'(sym-294-0 sym-294-1 sym-294-2 sym-294-3 sym-294-4 sym-294-5 sym-294-6 sym-294-7 sym-294-8 sym-294-9)
+'(sym-295-0 sym-295-1 sym-295-2 sym-295-3 sym-295-4 sym-295-5 sym-295-6 sym-295-7 sym-295-8 sym-295-9)
+'(sym-296-0 sym-296-1 sym-296-2 sym-296-3 sym-296-4 sym-296-5 sym-296-6 sym-296-7 sym-296-8 sym-296-9)
+'(sym-297-0 sym-297-1 sym-297-2 sym-297-3 sym-297-4 sym-297-5 sym-297-6 sym-297-7 sym-297-8 sym-297-9)
+'(sym-298-0 sym-298-1 sym-298-2 sym-298-3 sym-298-4 sym-298-5 sym-298-6 sym-298-7 sym-298-8 sym-298-9)
+'(sym-299-0 sym-299-1 sym-299-2 sym-299-3 sym-299-4 sym-299-5 sym-299-6 sym-299-7 sym-299-8 sym-299-9)
+'(sym-300-0 sym-300-1 sym-300-2 sym-300-3 sym-300-4 sym-300-5 sym-300-6 sym-300-7 sym-300-8 sym-300-9)
+'(sym-301-0 sym-301-1 sym-301-2 sym-301-3 sym-301-4 sym-301-5 sym-301-6 sym-301-7 sym-301-8 sym-301-9)
+'(sym-302-0 sym-302-1 sym-302-2 sym-302-3 sym-302-4 sym-302-5 sym-302-6 sym-302-7 sym-302-8 sym-302-9)
+'(sym-303-0 sym-303-1 sym-303-2 sym-303-3 sym-303-4 sym-303-5 sym-303-6 sym-303-7 sym-303-8 sym-303-9)
+'(sym-304-0 sym-304-1 sym-304-2 sym-304-3 sym-304-4 sym-304-5 sym-304-6 sym-304-7 sym-304-8 sym-304-9)
+'(sym-305-0 sym-305-1 sym-305-2 sym-305-3 sym-305-4 sym-305-5 sym-305-6 sym-305-7 sym-305-8 sym-305-9)
+'(sym-306-0 sym-306-1 sym-306-2 sym-306-3 sym-306-4 sym-306-5 sym-306-6 sym-306-7 sym-306-8 sym-306-9)
+'(sym-307-0 sym-307-1 sym-307-2 sym-307-3 sym-307-4 sym-307-5 sym-307-6 sym-307-7 sym-307-8 sym-307-9)
+'(sym-308-0 sym-308-1 sym-308-2 sym-308-3 sym-308-4 sym-308-5 sym-308-6 sym-308-7 sym-308-8 sym-308-9)
+'(sym-309-0 sym-309-1 sym-309-2 sym-309-3 sym-309-4 sym-309-5 sym-309-6 sym-309-7 sym-309-8 sym-309-9)
+'(sym-310-0 sym-310-1 sym-310-2 sym-310-3 sym-310-4 sym-310-5 sym-310-6 sym-310-7 sym-310-8 sym-310-9)
+'(sym-311-0 sym-311-1 sym-311-2 sym-311-3 sym-311-4 sym-311-5 sym-311-6 sym-311-7 sym-311-8 sym-311-9)
+'(sym-312-0 sym-312-1 sym-312-2 sym-312-3 sym-312-4 sym-312-5 sym-312-6 sym-312-7 sym-312-8 sym-312-9)
+'(sym-313-0 sym-313-1 sym-313-2 sym-313-3 sym-313-4 sym-313-5 sym-313-6 sym-313-7 sym-313-8 sym-313-9)
+'(sym-314-0 sym-314-1 sym-314-2 sym-314-3 sym-314-4 sym-314-5 sym-314-6 sym-314-7 sym-314-8 sym-314-9)
+'(sym-315-0 sym-315-1 sym-315-2 sym-315-3 sym-315-4 sym-315-5 sym-315-6 sym-315-7 sym-315-8 sym-315-9)
+'(sym-316-0 sym-316-1 sym-316-2 sym-316-3 sym-316-4 sym-316-5 sym-316-6 sym-316-7 sym-316-8 sym-316-9)
+'(sym-317-0 sym-317-1 sym-317-2 sym-317-3 sym-317-4 sym-317-5 sym-317-6 sym-317-7 sym-317-8 sym-317-9)
+'(sym-318-0 sym-318-1 sym-318-2 sym-318-3 sym-318-4 sym-318-5 sym-318-6 sym-318-7 sym-318-8 sym-318-9)
+'(sym-319-0 sym-319-1 sym-319-2 sym-319-3 sym-319-4 sym-319-5 sym-319-6 sym-319-7 sym-319-8 sym-319-9)
+'(sym-320-0 sym-320-1 sym-320-2 sym-320-3 sym-320-4 sym-320-5 sym-320-6 sym-320-7 sym-320-8 sym-320-9)
+'(sym-321-0 sym-321-1 sym-321-2 sym-321-3 sym-321-4 sym-321-5 sym-321-6 sym-321-7 sym-321-8 sym-321-9)
+'(sym-322-0 sym-322-1 sym-322-2 sym-322-3 sym-322-4 sym-322-5 sym-322-6 sym-322-7 sym-322-8 sym-322-9)
+'(sym-323-0 sym-323-1 sym-323-2 sym-323-3 sym-323-4 sym-323-5 sym-323-6 sym-323-7 sym-323-8 sym-323-9)
+'(sym-324-0 sym-324-1 sym-324-2 sym-324-3 sym-324-4 sym-324-5 sym-324-6 sym-324-7 sym-324-8 sym-324-9)
+'(sym-325-0 sym-325-1 sym-325-2 sym-325-3 sym-325-4 sym-325-5 sym-325-6 sym-325-7 sym-325-8 sym-325-9)
+'(sym-326-0 sym-326-1 sym-326-2 sym-326-3 sym-326-4 sym-326-5 sym-326-6 sym-326-7 sym-326-8 sym-326-9)
+'(sym-327-0 sym-327-1 sym-327-2 sym-327-3 sym-327-4 sym-327-5 sym-327-6 sym-327-7 sym-327-8 sym-327-9)
+'(sym-328-0 sym-328-1 sym-328-2 sym-328-3 sym-328-4 sym-328-5 sym-328-6 sym-328-7 sym-328-8 sym-328-9)
+'(sym-329-0 sym-329-1 sym-329-2 sym-329-3 sym-329-4 sym-329-5 sym-329-6 sym-329-7 sym-329-8 sym-329-9)
+'(sym-330-0 sym-330-1 sym-330-2 sym-330-3 sym-330-4 sym-330-5 sym-330-6 sym-330-7 sym-330-8 sym-330-9)
+'(sym-331-0 sym-331-1 sym-331-2 sym-331-3 sym-331-4 sym-331-5 sym-331-6 sym-331-7 sym-331-8 sym-331-9)
+'(sym-332-0 sym-332-1 sym-332-2 sym-332-3 sym-332-4 sym-332-5 sym-332-6 sym-332-7 sym-332-8 sym-332-9)
+'(sym-333-0 sym-333-1 sym-333-2 sym-333-3 sym-333-4 sym-333-5 sym-333-6 sym-333-7 sym-333-8 sym-333-9)
+'(sym-334-0 sym-334-1 sym-334-2 sym-334-3 sym-334-4 sym-334-5 sym-334-6 sym-334-7 sym-334-8 sym-334-9)
+'(sym-335-0 sym-335-1 sym-335-2 sym-335-3 sym-335-4 sym-335-5 sym-335-6 sym-335-7 sym-335-8 sym-335-9)
+'(sym-336-0 sym-336-1 sym-336-2 sym-336-3 sym-336-4 sym-336-5 sym-336-6 sym-336-7 sym-336-8 sym-336-9)
+'(sym-337-0 sym-337-1 sym-337-2 sym-337-3 sym-337-4 sym-337-5 sym-337-6 sym-337-7 sym-337-8 sym-337-9)
+'(sym-338-0 sym-338-1 sym-338-2 sym-338-3 sym-338-4 sym-338-5 sym-338-6 sym-338-7 sym-338-8 sym-338-9)
+'(sym-339-0 sym-339-1 sym-339-2 sym-339-3 sym-339-4 sym-339-5 sym-339-6 sym-339-7 sym-339-8 sym-339-9)
+'(sym-340-0 sym-340-1 sym-340-2 sym-340-3 sym-340-4 sym-340-5 sym-340-6 sym-340-7 sym-340-8 sym-340-9)
+'(sym-341-0 sym-341-1 sym-341-2 sym-341-3 sym-341-4 sym-341-5 sym-341-6 sym-341-7 sym-341-8 sym-341-9)
+'(sym-342-0 sym-342-1 sym-342-2 sym-342-3 sym-342-4 sym-342-5 sym-342-6 sym-342-7 sym-342-8 sym-342-9)
+'(sym-343-0 sym-343-1 sym-343-2 sym-343-3 sym-343-4 sym-343-5 sym-343-6 sym-343-7 sym-343-8 sym-343-9)
+'(sym-344-0 sym-344-1 sym-344-2 sym-344-3 sym-344-4 sym-344-5 sym-344-6 sym-344-7 sym-344-8 sym-344-9)
+'(sym-345-0 sym-345-1 sym-345-2 sym-345-3 sym-345-4 sym-345-5 sym-345-6 sym-345-7 sym-345-8 sym-345-9)
+'(sym-346-0 sym-346-1 sym-346-2 sym-346-3 sym-346-4 sym-346-5 sym-346-6 sym-346-7 sym-346-8 sym-346-9)
+'(sym-347-0 sym-347-1 sym-347-2 sym-347-3 sym-347-4 sym-347-5 sym-347-6 sym-347-7 sym-347-8 sym-347-9)
+'(sym-348-0 sym-348-1 sym-348-2 sym-348-3 sym-348-4 sym-348-5 sym-348-6 sym-348-7 sym-348-8 sym-348-9)
+'(sym-349-0 sym-349-1 sym-349-2 sym-349-3 sym-349-4 sym-349-5 sym-349-6 sym-349-7 sym-349-8 sym-349-9)
+'(sym-350-0 sym-350-1 sym-350-2 sym-350-3 sym-350-4 sym-350-5 sym-350-6 sym-350-7 sym-350-8 sym-350-9)
+'(sym-351-0 sym-351-1 sym-351-2 sym-351-3 sym-351-4 sym-351-5 sym-351-6 sym-351-7 sym-351-8 sym-351-9)
+'(sym-352-0 sym-352-1 sym-352-2 sym-352-3 sym-352-4 sym-352-5 sym-352-6 sym-352-7 sym-352-8 sym-352-9)
+'(sym-353-0 sym-353-1 sym-353-2 sym-353-3 sym-353-4 sym-353-5 sym-353-6 sym-353-7 sym-353-8 sym-353-9)
+'(sym-354-0 sym-354-1 sym-354-2 sym-354-3 sym-354-4 sym-354-5 sym-354-6 sym-354-7 sym-354-8 sym-354-9)
+'(sym-355-0 sym-355-1 sym-355-2 sym-355-3 sym-355-4 sym-355-5 sym-355-6 sym-355-7 sym-355-8 sym-355-9)
+'(sym-356-0 sym-356-1 sym-356-2 sym-356-3 sym-356-4 sym-356-5 sym-356-6 sym-356-7 sym-356-8 sym-356-9)
+'(sym-357-0 sym-357-1 sym-357-2 sym-357-3 sym-357-4 sym-357-5 sym-357-6 sym-357-7 sym-357-8 sym-357-9)
+'(sym-358-0 sym-358-1 sym-358-2 sym-358-3 sym-358-4 sym-358-5 sym-358-6 sym-358-7 sym-358-8 sym-358-9)
+'(sym-359-0 sym-359-1 sym-359-2 sym-359-3 sym-359-4 sym-359-5 sym-359-6 sym-359-7 sym-359-8 sym-359-9)
+'(sym-360-0 sym-360-1 sym-360-2 sym-360-3 sym-360-4 sym-360-5 sym-360-6 sym-360-7 sym-360-8 sym-360-9)
+'(sym-361-0 sym-361-1 sym-361-2 sym-361-3 sym-361-4 sym-361-5 sym-361-6 sym-361-7 sym-361-8 sym-361-9)
+'(sym-362-0 sym-362-1 sym-362-2 sym-362-3 sym-362-4 sym-362-5 sym-362-6 sym-362-7 sym-362-8 sym-362-9)
+'(sym-363-0 sym-363-1 sym-363-2 sym-363-3 sym-363-4 sym-363-5 sym-363-6 sym-363-7 sym-363-8 sym-363-9)
+'(sym-364-0 sym-364-1 sym-364-2 sym-364-3 sym-364-4 sym-364-5 sym-364-6 sym-364-7 sym-364-8 sym-364-9)
+'(sym-365-0 sym-365-1 sym-365-2 sym-365-3 sym-365-4 sym-365-5 sym-365-6 sym-365-7 sym-365-8 sym-365-9)
+'(sym-366-0 sym-366-1 sym-366-2 sym-366-3 sym-366-4 sym-366-5 sym-366-6 sym-366-7 sym-366-8 sym-366-9)
+'(sym-367-0 sym-367-1 sym-367-2 sym-367-3 sym-367-4 sym-367-5 sym-367-6 sym-367-7 sym-367-8 sym-367-9)
+'(sym-368-0 sym-368-1 sym-368-2 sym-368-3 sym-368-4 sym-368-5 sym-368-6 sym-368-7 sym-368-8 sym-368-9)
+'(sym-369-0 sym-369-1 sym-369-2 sym-369-3 sym-369-4 sym-369-5 sym-369-6 sym-369-7 sym-369-8 sym-369-9)
+'(sym-370-0 sym-370-1 sym-370-2 sym-370-3 sym-370-4 sym-370-5 sym-370-6 sym-370-7 sym-370-8 sym-370-9)
+'(sym-371-0 sym-371-1 sym-371-2 sym-371-3 sym-371-4 sym-371-5 sym-371-6 sym-371-7 sym-371-8 sym-371-9)
+'(sym-372-0 sym-372-1 sym-372-2 sym-372-3 sym-372-4 sym-372-5 sym-372-6 sym-372-7 sym-372-8 sym-372-9)
+'(sym-373-0 sym-373-1 sym-373-2 sym-373-3 sym-373-4 sym-373-5 sym-373-6 sym-373-7 sym-373-8 sym-373-9)
+'(sym-374-0 sym-374-1 sym-374-2 sym-374-3 sym-374-4 sym-374-5 sym-374-6 sym-374-7 sym-374-8 sym-374-9)
+'(sym-375-0 sym-375-1 sym-375-2 sym-375-3 sym-375-4 sym-375-5 sym-375-6 sym-375-7 sym-375-8 sym-375-9)
+'(sym-376-0 sym-376-1 sym-376-2 sym-376-3 sym-376-4 sym-376-5 sym-376-6 sym-376-7 sym-376-8 sym-376-9)
+'(sym-377-0 sym-377-1 sym-377-2 sym-377-3 sym-377-4 sym-377-5 sym-377-6 sym-377-7 sym-377-8 sym-377-9)
+'(sym-378-0 sym-378-1 sym-378-2 sym-378-3 sym-378-4 sym-378-5 sym-378-6 sym-378-7 sym-378-8 sym-378-9)
+'(sym-379-0 sym-379-1 sym-379-2 sym-379-3 sym-379-4 sym-379-5 sym-379-6 sym-379-7 sym-379-8 sym-379-9)
+'(sym-380-0 sym-380-1 sym-380-2 sym-380-3 sym-380-4 sym-380-5 sym-380-6 sym-380-7 sym-380-8 sym-380-9)
+'(sym-381-0 sym-381-1 sym-381-2 sym-381-3 sym-381-4 sym-381-5 sym-381-6 sym-381-7 sym-381-8 sym-381-9)
+'(sym-382-0 sym-382-1 sym-382-2 sym-382-3 sym-382-4 sym-382-5 sym-382-6 sym-382-7 sym-382-8 sym-382-9)
+'(sym-383-0 sym-383-1 sym-383-2 sym-383-3 sym-383-4 sym-383-5 sym-383-6 sym-383-7 sym-383-8 sym-383-9)
+'(sym-384-0 sym-384-1 sym-384-2 sym-384-3 sym-384-4 sym-384-5 sym-384-6 sym-384-7 sym-384-8 sym-384-9)
+'(sym-385-0 sym-385-1 sym-385-2 sym-385-3 sym-385-4 sym-385-5 sym-385-6 sym-385-7 sym-385-8 sym-385-9)
+'(sym-386-0 sym-386-1 sym-386-2 sym-386-3 sym-386-4 sym-386-5 sym-386-6 sym-386-7 sym-386-8 sym-386-9)
+'(sym-387-0 sym-387-1 sym-387-2 sym-387-3 sym-387-4 sym-387-5 sym-387-6 sym-387-7 sym-387-8 sym-387-9)
+'(sym-388-0 sym-388-1 sym-388-2 sym-388-3 sym-388-4 sym-388-5 sym-388-6 sym-388-7 sym-388-8 sym-388-9)
+'(sym-389-0 sym-389-1 sym-389-2 sym-389-3 sym-389-4 sym-389-5 sym-389-6 sym-389-7 sym-389-8 sym-389-9)
+'(sym-390-0 sym-390-1 sym-390-2 sym-390-3 sym-390-4 sym-390-5 sym-390-6 sym-390-7 sym-390-8 sym-390-9)
+'(sym-391-0 sym-391-1 sym-391-2 sym-391-3 sym-391-4 sym-391-5 sym-391-6 sym-391-7 sym-391-8 sym-391-9)
+'(sym-392-0 sym-392-1 sym-392-2 sym-392-3 sym-392-4 sym-392-5 sym-392-6 sym-392-7 sym-392-8 sym-392-9)
+'(sym-393-0 sym-393-1 sym-393-2 sym-393-3 sym-393-4 sym-393-5 sym-393-6 sym-393-7 sym-393-8 sym-393-9)
+'(sym-394-0 sym-394-1 sym-394-2 sym-394-3 sym-394-4 sym-394-5 sym-394-6 sym-394-7 sym-394-8 sym-394-9)
+'(sym-395-0 sym-395-1 sym-395-2 sym-395-3 sym-395-4 sym-395-5 sym-395-6 sym-395-7 sym-395-8 sym-395-9)
+'(sym-396-0 sym-396-1 sym-396-2 sym-396-3 sym-396-4 sym-396-5 sym-396-6 sym-396-7 sym-396-8 sym-396-9)
+'(sym-397-0 sym-397-1 sym-397-2 sym-397-3 sym-397-4 sym-397-5 sym-397-6 sym-397-7 sym-397-8 sym-397-9)
+'(sym-398-0 sym-398-1 sym-398-2 sym-398-3 sym-398-4 sym-398-5 sym-398-6 sym-398-7 sym-398-8 sym-398-9)
+'(sym-399-0 sym-399-1 sym-399-2 sym-399-3 sym-399-4 sym-399-5 sym-399-6 sym-399-7 sym-399-8 sym-399-9)
+'(sym-0-0 sym-0-1 sym-0-2 sym-0-3 sym-0-4 sym-0-5 sym-0-6 sym-0-7 sym-0-8 sym-0-9)
+'(sym-1-0 sym-1-1 sym-1-2 sym-1-3 sym-1-4 sym-1-5 sym-1-6 sym-1-7 sym-1-8 sym-1-9)
+'(sym-2-0 sym-2-1 sym-2-2 sym-2-3 sym-2-4 sym-2-5 sym-2-6 sym-2-7 sym-2-8 sym-2-9)
+'(sym-3-0 sym-3-1 sym-3-2 sym-3-3 sym-3-4 sym-3-5 sym-3-6 sym-3-7 sym-3-8 sym-3-9)
+'(sym-4-0 sym-4-1 sym-4-2 sym-4-3 sym-4-4 sym-4-5 sym-4-6 sym-4-7 sym-4-8 sym-4-9)
+'(sym-5-0 sym-5-1 sym-5-2 sym-5-3 sym-5-4 sym-5-5 sym-5-6 sym-5-7 sym-5-8 sym-5-9)
+'(sym-6-0 sym-6-1 sym-6-2 sym-6-3 sym-6-4 sym-6-5 sym-6-6 sym-6-7 sym-6-8 sym-6-9)
+'(sym-7-0 sym-7-1 sym-7-2 sym-7-3 sym-7-4 sym-7-5 sym-7-6 sym-7-7 sym-7-8 sym-7-9)
+'(sym-8-0 sym-8-1 sym-8-2 sym-8-3 sym-8-4 sym-8-5 sym-8-6 sym-8-7 sym-8-8 sym-8-9)
+'(sym-9-0 sym-9-1 sym-9-2 sym-9-3 sym-9-4 sym-9-5 sym-9-6 sym-9-7 sym-9-8 sym-9-9)
+'(sym-10-0 sym-10-1 sym-10-2 sym-10-3 sym-10-4 sym-10-5 sym-10-6 sym-10-7 sym-10-8 sym-10-9)
+'(sym-11-0 sym-11-1 sym-11-2 sym-11-3 sym-11-4 sym-11-5 sym-11-6 sym-11-7 sym-11-8 sym-11-9)
+'(sym-12-0 sym-12-1 sym-12-2 sym-12-3 sym-12-4 sym-12-5 sym-12-6 sym-12-7 sym-12-8 sym-12-9)
+'(sym-13-0 sym-13-1 sym-13-2 sym-13-3 sym-13-4 sym-13-5 sym-13-6 sym-13-7 sym-13-8 sym-13-9)
+'(sym-14-0 sym-14-1 sym-14-2 sym-14-3 sym-14-4 sym-14-5 sym-14-6 sym-14-7 sym-14-8 sym-14-9)
+'(sym-15-0 sym-15-1 sym-15-2 sym-15-3 sym-15-4 sym-15-5 sym-15-6 sym-15-7 sym-15-8 sym-15-9)
+'(sym-16-0 sym-16-1 sym-16-2 sym-16-3 sym-16-4 sym-16-5 sym-16-6 sym-16-7 sym-16-8 sym-16-9)
+'(sym-17-0 sym-17-1 sym-17-2 sym-17-3 sym-17-4 sym-17-5 sym-17-6 sym-17-7 sym-17-8 sym-17-9)
+'(sym-18-0 sym-18-1 sym-18-2 sym-18-3 sym-18-4 sym-18-5 sym-18-6 sym-18-7 sym-18-8 sym-18-9)
+'(sym-19-0 sym-19-1 sym-19-2 sym-19-3 sym-19-4 sym-19-5 sym-19-6 sym-19-7 sym-19-8 sym-19-9)
+'(sym-20-0 sym-20-1 sym-20-2 sym-20-3 sym-20-4 sym-20-5 sym-20-6 sym-20-7 sym-20-8 sym-20-9)
+'(sym-21-0 sym-21-1 sym-21-2 sym-21-3 sym-21-4 sym-21-5 sym-21-6 sym-21-7 sym-21-8 sym-21-9)
+'(sym-22-0 sym-22-1 sym-22-2 sym-22-3 sym-22-4 sym-22-5 sym-22-6 sym-22-7 sym-22-8 sym-22-9)
+'(sym-23-0 sym-23-1 sym-23-2 sym-23-3 sym-23-4 sym-23-5 sym-23-6 sym-23-7 sym-23-8 sym-23-9)
+'(sym-24-0 sym-24-1 sym-24-2 sym-24-3 sym-24-4 sym-24-5 sym-24-6 sym-24-7 sym-24-8 sym-24-9)
+'(sym-25-0 sym-25-1 sym-25-2 sym-25-3 sym-25-4 sym-25-5 sym-25-6 sym-25-7 sym-25-8 sym-25-9)
+'(sym-26-0 sym-26-1 sym-26-2 sym-26-3 sym-26-4 sym-26-5 sym-26-6 sym-26-7 sym-26-8 sym-26-9)
+'(sym-27-0 sym-27-1 sym-27-2 sym-27-3 sym-27-4 sym-27-5 sym-27-6 sym-27-7 sym-27-8 sym-27-9)
+'(sym-28-0 sym-28-1 sym-28-2 sym-28-3 sym-28-4 sym-28-5 sym-28-6 sym-28-7 sym-28-8 sym-28-9)
+'(sym-29-0 sym-29-1 sym-29-2 sym-29-3 sym-29-4 sym-29-5 sym-29-6 sym-29-7 sym-29-8 sym-29-9)
+'(sym-30-0 sym-30-1 sym-30-2 sym-30-3 sym-30-4 sym-30-5 sym-30-6 sym-30-7 sym-30-8 sym-30-9)
+'(sym-31-0 sym-31-1 sym-31-2 sym-31-3 sym-31-4 sym-31-5 sym-31-6 sym-31-7 sym-31-8 sym-31-9)
+'(sym-32-0 sym-32-1 sym-32-2 sym-32-3 sym-32-4 sym-32-5 sym-32-6 sym-32-7 sym-32-8 sym-32-9)
+'(sym-33-0 sym-33-1 sym-33-2 sym-33-3 sym-33-4 sym-33-5 sym-33-6 sym-33-7 sym-33-8 sym-33-9)
+'(sym-34-0 sym-34-1 sym-34-2 sym-34-3 sym-34-4 sym-34-5 sym-34-6 sym-34-7 sym-34-8 sym-34-9)
+'(sym-35-0 sym-35-1 sym-35-2 sym-35-3 sym-35-4 sym-35-5 sym-35-6 sym-35-7 sym-35-8 sym-35-9)
+'(sym-36-0 sym-36-1 sym-36-2 sym-36-3 sym-36-4 sym-36-5 sym-36-6 sym-36-7 sym-36-8 sym-36-9)
+'(sym-37-0 sym-37-1 sym-37-2 sym-37-3 sym-37-4 sym-37-5 sym-37-6 sym-37-7 sym-37-8 sym-37-9)
+'(sym-38-0 sym-38-1 sym-38-2 sym-38-3 sym-38-4 sym-38-5 sym-38-6 sym-38-7 sym-38-8 sym-38-9)
+'(sym-39-0 sym-39-1 sym-39-2 sym-39-3 sym-39-4 sym-39-5 sym-39-6 sym-39-7 sym-39-8 sym-39-9)
+'(sym-40-0 sym-40-1 sym-40-2 sym-40-3 sym-40-4 sym-40-5 sym-40-6 sym-40-7 sym-40-8 sym-40-9)
+'(sym-41-0 sym-41-1 sym-41-2 sym-41-3 sym-41-4 sym-41-5 sym-41-6 sym-41-7 sym-41-8 sym-41-9)
+'(sym-42-0 sym-42-1 sym-42-2 sym-42-3 sym-42-4 sym-42-5 sym-42-6 sym-42-7 sym-42-8 sym-42-9)
+'(sym-43-0 sym-43-1 sym-43-2 sym-43-3 sym-43-4 sym-43-5 sym-43-6 sym-43-7 sym-43-8 sym-43-9)
+'(sym-44-0 sym-44-1 sym-44-2 sym-44-3 sym-44-4 sym-44-5 sym-44-6 sym-44-7 sym-44-8 sym-44-9)
+'(sym-45-0 sym-45-1 sym-45-2 sym-45-3 sym-45-4 sym-45-5 sym-45-6 sym-45-7 sym-45-8 sym-45-9)
+'(sym-46-0 sym-46-1 sym-46-2 sym-46-3 sym-46-4 sym-46-5 sym-46-6 sym-46-7 sym-46-8 sym-46-9)
+'(sym-47-0 sym-47-1 sym-47-2 sym-47-3 sym-47-4 sym-47-5 sym-47-6 sym-47-7 sym-47-8 sym-47-9)
+'(sym-48-0 sym-48-1 sym-48-2 sym-48-3 sym-48-4 sym-48-5 sym-48-6 sym-48-7 sym-48-8 sym-48-9)
+'(sym-49-0 sym-49-1 sym-49-2 sym-49-3 sym-49-4 sym-49-5 sym-49-6 sym-49-7 sym-49-8 sym-49-9)
+'(sym-50-0 sym-50-1 sym-50-2 sym-50-3 sym-50-4 sym-50-5 sym-50-6 sym-50-7 sym-50-8 sym-50-9)
+'(sym-51-0 sym-51-1 sym-51-2 sym-51-3 sym-51-4 sym-51-5 sym-51-6 sym-51-7 sym-51-8 sym-51-9)
+'(sym-52-0 sym-52-1 sym-52-2 sym-52-3 sym-52-4 sym-52-5 sym-52-6 sym-52-7 sym-52-8 sym-52-9)
+'(sym-53-0 sym-53-1 sym-53-2 sym-53-3 sym-53-4 sym-53-5 sym-53-6 sym-53-7 sym-53-8 sym-53-9)
+'(sym-54-0 sym-54-1 sym-54-2 sym-54-3 sym-54-4 sym-54-5 sym-54-6 sym-54-7 sym-54-8 sym-54-9)
+'(sym-55-0 sym-55-1 sym-55-2 sym-55-3 sym-55-4 sym-55-5 sym-55-6 sym-55-7 sym-55-8 sym-55-9)
+'(sym-56-0 sym-56-1 sym-56-2 sym-56-3 sym-56-4 sym-56-5 sym-56-6 sym-56-7 sym-56-8 sym-56-9)
+'(sym-57-0 sym-57-1 sym-57-2 sym-57-3 sym-57-4 sym-57-5 sym-57-6 sym-57-7 sym-57-8 sym-57-9)
+'(sym-58-0 sym-58-1 sym-58-2 sym-58-3 sym-58-4 sym-58-5 sym-58-6 sym-58-7 sym-58-8 sym-58-9)
+'(sym-59-0 sym-59-1 sym-59-2 sym-59-3 sym-59-4 sym-59-5 sym-59-6 sym-59-7 sym-59-8 sym-59-9)
+'(sym-60-0 sym-60-1 sym-60-2 sym-60-3 sym-60-4 sym-60-5 sym-60-6 sym-60-7 sym-60-8 sym-60-9)
+'(sym-61-0 sym-61-1 sym-61-2 sym-61-3 sym-61-4 sym-61-5 sym-61-6 sym-61-7 sym-61-8 sym-61-9)
+'(sym-62-0 sym-62-1 sym-62-2 sym-62-3 sym-62-4 sym-62-5 sym-62-6 sym-62-7 sym-62-8 sym-62-9)
+'(sym-63-0 sym-63-1 sym-63-2 sym-63-3 sym-63-4 sym-63-5 sym-63-6 sym-63-7 sym-63-8 sym-63-9)
+'(sym-64-0 sym-64-1 sym-64-2 sym-64-3 sym-64-4 sym-64-5 sym-64-6 sym-64-7 sym-64-8 sym-64-9)
+'(sym-65-0 sym-65-1 sym-65-2 sym-65-3 sym-65-4 sym-65-5 sym-65-6 sym-65-7 sym-65-8 sym-65-9)
+'(sym-66-0 sym-66-1 sym-66-2 sym-66-3 sym-66-4 sym-66-5 sym-66-6 sym-66-7 sym-66-8 sym-66-9)
+'(sym-67-0 sym-67-1 sym-67-2 sym-67-3 sym-67-4 sym-67-5 sym-67-6 sym-67-7 sym-67-8 sym-67-9)
+'(sym-68-0 sym-68-1 sym-68-2 sym-68-3 sym-68-4 sym-68-5 sym-68-6 sym-68-7 sym-68-8 sym-68-9)
+'(sym-69-0 sym-69-1 sym-69-2 sym-69-3 sym-69-4 sym-69-5 sym-69-6 sym-69-7 sym-69-8 sym-69-9)
+'(sym-70-0 sym-70-1 sym-70-2 sym-70-3 sym-70-4 sym-70-5 sym-70-6 sym-70-7 sym-70-8 sym-70-9)
+'(sym-71-0 sym-71-1 sym-71-2 sym-71-3 sym-71-4 sym-71-5 sym-71-6 sym-71-7 sym-71-8 sym-71-9)
+'(sym-72-0 sym-72-1 sym-72-2 sym-72-3 sym-72-4 sym-72-5 sym-72-6 sym-72-7 sym-72-8 sym-72-9)
+'(sym-73-0 sym-73-1 sym-73-2 sym-73-3 sym-73-4 sym-73-5 sym-73-6 sym-73-7 sym-73-8 sym-73-9)
+'(sym-74-0 sym-74-1 sym-74-2 sym-74-3 sym-74-4 sym-74-5 sym-74-6 sym-74-7 sym-74-8 sym-74-9)
+'(sym-75-0 sym-75-1 sym-75-2 sym-75-3 sym-75-4 sym-75-5 sym-75-6 sym-75-7 sym-75-8 sym-75-9)
+'(sym-76-0 sym-76-1 sym-76-2 sym-76-3 sym-76-4 sym-76-5 sym-76-6 sym-76-7 sym-76-8 sym-76-9)
+'(sym-77-0 sym-77-1 sym-77-2 sym-77-3 sym-77-4 sym-77-5 sym-77-6 sym-77-7 sym-77-8 sym-77-9)
+'(sym-78-0 sym-78-1 sym-78-2 sym-78-3 sym-78-4 sym-78-5 sym-78-6 sym-78-7 sym-78-8 sym-78-9)
+'(sym-79-0 sym-79-1 sym-79-2 sym-79-3 sym-79-4 sym-79-5 sym-79-6 sym-79-7 sym-79-8 sym-79-9)
+'(sym-80-0 sym-80-1 sym-80-2 sym-80-3 sym-80-4 sym-80-5 sym-80-6 sym-80-7 sym-80-8 sym-80-9)
+'(sym-81-0 sym-81-1 sym-81-2 sym-81-3 sym-81-4 sym-81-5 sym-81-6 sym-81-7 sym-81-8 sym-81-9)
+'(sym-82-0 sym-82-1 sym-82-2 sym-82-3 sym-82-4 sym-82-5 sym-82-6 sym-82-7 sym-82-8 sym-82-9)
+'(sym-83-0 sym-83-1 sym-83-2 sym-83-3 sym-83-4 sym-83-5 sym-83-6 sym-83-7 sym-83-8 sym-83-9)
+'(sym-84-0 sym-84-1 sym-84-2 sym-84-3 sym-84-4 sym-84-5 sym-84-6 sym-84-7 sym-84-8 sym-84-9)
+'(sym-85-0 sym-85-1 sym-85-2 sym-85-3 sym-85-4 sym-85-5 sym-85-6 sym-85-7 sym-85-8 sym-85-9)
+'(sym-86-0 sym-86-1 sym-86-2 sym-86-3 sym-86-4 sym-86-5 sym-86-6 sym-86-7 sym-86-8 sym-86-9)
+'(sym-87-0 sym-87-1 sym-87-2 sym-87-3 sym-87-4 sym-87-5 sym-87-6 sym-87-7 sym-87-8 sym-87-9)
+'(sym-88-0 sym-88-1 sym-88-2 sym-88-3 sym-88-4 sym-88-5 sym-88-6 sym-88-7 sym-88-8 sym-88-9)
+'(sym-89-0 sym-89-1 sym-89-2 sym-89-3 sym-89-4 sym-89-5 sym-89-6 sym-89-7 sym-89-8 sym-89-9)
+'(sym-90-0 sym-90-1 sym-90-2 sym-90-3 sym-90-4 sym-90-5 sym-90-6 sym-90-7 sym-90-8 sym-90-9)
+'(sym-91-0 sym-91-1 sym-91-2 sym-91-3 sym-91-4 sym-91-5 sym-91-6 sym-91-7 sym-91-8 sym-91-9)
+'(sym-92-0 sym-92-1 sym-92-2 sym-92-3 sym-92-4 sym-92-5 sym-92-6 sym-92-7 sym-92-8 sym-92-9)
+'(sym-93-0 sym-93-1 sym-93-2 sym-93-3 sym-93-4 sym-93-5 sym-93-6 sym-93-7 sym-93-8 sym-93-9)
+'(sym-94-0 sym-94-1 sym-94-2 sym-94-3 sym-94-4 sym-94-5 sym-94-6 sym-94-7 sym-94-8 sym-94-9)
+'(sym-95-0 sym-95-1 sym-95-2 sym-95-3 sym-95-4 sym-95-5 sym-95-6 sym-95-7 sym-95-8 sym-95-9)
+'(sym-96-0 sym-96-1 sym-96-2 sym-96-3 sym-96-4 sym-96-5 sym-96-6 sym-96-7 sym-96-8 sym-96-9)
+'(sym-97-0 sym-97-1 sym-97-2 sym-97-3 sym-97-4 sym-97-5 sym-97-6 sym-97-7 sym-97-8 sym-97-9)
+'(sym-98-0 sym-98-1 sym-98-2 sym-98-3 sym-98-4 sym-98-5 sym-98-6 sym-98-7 sym-98-8 sym-98-9)
+'(sym-99-0 sym-99-1 sym-99-2 sym-99-3 sym-99-4 sym-99-5 sym-99-6 sym-99-7 sym-99-8 sym-99-9)
+'(sym-100-0 sym-100-1 sym-100-2 sym-100-3 sym-100-4 sym-100-5 sym-100-6 sym-100-7 sym-100-8 sym-100-9)
+'(sym-101-0 sym-101-1 sym-101-2 sym-101-3 sym-101-4 sym-101-5 sym-101-6 sym-101-7 sym-101-8 sym-101-9)
+'(sym-102-0 sym-102-1 sym-102-2 sym-102-3 sym-102-4 sym-102-5 sym-102-6 sym-102-7 sym-102-8 sym-102-9)
+'(sym-103-0 sym-103-1 sym-103-2 sym-103-3 sym-103-4 sym-103-5 sym-103-6 sym-103-7 sym-103-8 sym-103-9)
+'(sym-104-0 sym-104-1 sym-104-2 sym-104-3 sym-104-4 sym-104-5 sym-104-6 sym-104-7 sym-104-8 sym-104-9)
+'(sym-105-0 sym-105-1 sym-105-2 sym-105-3 sym-105-4 sym-105-5 sym-105-6 sym-105-7 sym-105-8 sym-105-9)
+'(sym-106-0 sym-106-1 sym-106-2 sym-106-3 sym-106-4 sym-106-5 sym-106-6 sym-106-7 sym-106-8 sym-106-9)
+'(sym-107-0 sym-107-1 sym-107-2 sym-107-3 sym-107-4 sym-107-5 sym-107-6 sym-107-7 sym-107-8 sym-107-9)
+'(sym-108-0 sym-108-1 sym-108-2 sym-108-3 sym-108-4 sym-108-5 sym-108-6 sym-108-7 sym-108-8 sym-108-9)
+'(sym-109-0 sym-109-1 sym-109-2 sym-109-3 sym-109-4 sym-109-5 sym-109-6 sym-109-7 sym-109-8 sym-109-9)
+'(sym-110-0 sym-110-1 sym-110-2 sym-110-3 sym-110-4 sym-110-5 sym-110-6 sym-110-7 sym-110-8 sym-110-9)
+'(sym-111-0 sym-111-1 sym-111-2 sym-111-3 sym-111-4 sym-111-5 sym-111-6 sym-111-7 sym-111-8 sym-111-9)
+'(sym-112-0 sym-112-1 sym-112-2 sym-112-3 sym-112-4 sym-112-5 sym-112-6 sym-112-7 sym-112-8 sym-112-9)
+'(sym-113-0 sym-113-1 sym-113-2 sym-113-3 sym-113-4 sym-113-5 sym-113-6 sym-113-7 sym-113-8 sym-113-9)
+'(sym-114-0 sym-114-1 sym-114-2 sym-114-3 sym-114-4 sym-114-5 sym-114-6 sym-114-7 sym-114-8 sym-114-9)
+'(sym-115-0 sym-115-1 sym-115-2 sym-115-3 sym-115-4 sym-115-5 sym-115-6 sym-115-7 sym-115-8 sym-115-9)
+'(sym-116-0 sym-116-1 sym-116-2 sym-116-3 sym-116-4 sym-116-5 sym-116-6 sym-116-7 sym-116-8 sym-116-9)
+'(sym-117-0 sym-117-1 sym-117-2 sym-117-3 sym-117-4 sym-117-5 sym-117-6 sym-117-7 sym-117-8 sym-117-9)
+'(sym-118-0 sym-118-1 sym-118-2 sym-118-3 sym-118-4 sym-118-5 sym-118-6 sym-118-7 sym-118-8 sym-118-9)
+'(sym-119-0 sym-119-1 sym-119-2 sym-119-3 sym-119-4 sym-119-5 sym-119-6 sym-119-7 sym-119-8 sym-119-9)
+'(sym-120-0 sym-120-1 sym-120-2 sym-120-3 sym-120-4 sym-120-5 sym-120-6 sym-120-7 sym-120-8 sym-120-9)
+'(sym-121-0 sym-121-1 sym-121-2 sym-121-3 sym-121-4 sym-121-5 sym-121-6 sym-121-7 sym-121-8 sym-121-9)
+'(sym-122-0 sym-122-1 sym-122-2 sym-122-3 sym-122-4 sym-122-5 sym-122-6 sym-122-7 sym-122-8 sym-122-9)
+'(sym-123-0 sym-123-1 sym-123-2 sym-123-3 sym-123-4 sym-123-5 sym-123-6 sym-123-7 sym-123-8 sym-123-9)
+'(sym-124-0 sym-124-1 sym-124-2 sym-124-3 sym-124-4 sym-124-5 sym-124-6 sym-124-7 sym-124-8 sym-124-9)
+'(sym-125-0 sym-125-1 sym-125-2 sym-125-3 sym-125-4 sym-125-5 sym-125-6 sym-125-7 sym-125-8 sym-125-9)
+'(sym-126-0 sym-126-1 sym-126-2 sym-126-3 sym-126-4 sym-126-5 sym-126-6 sym-126-7 sym-126-8 sym-126-9)
+'(sym-127-0 sym-127-1 sym-127-2 sym-127-3 sym-127-4 sym-127-5 sym-127-6 sym-127-7 sym-127-8 sym-127-9)
+'(sym-128-0 sym-128-1 sym-128-2 sym-128-3 sym-128-4 sym-128-5 sym-128-6 sym-128-7 sym-128-8 sym-128-9)
+'(sym-129-0 sym-129-1 sym-129-2 sym-129-3 sym-129-4 sym-129-5 sym-129-6 sym-129-7 sym-129-8 sym-129-9)
+'(sym-130-0 sym-130-1 sym-130-2 sym-130-3 sym-130-4 sym-130-5 sym-130-6 sym-130-7 sym-130-8 sym-130-9)
+'(sym-131-0 sym-131-1 sym-131-2 sym-131-3 sym-131-4 sym-131-5 sym-131-6 sym-131-7 sym-131-8 sym-131-9)
+'(sym-132-0 sym-132-1 sym-132-2 sym-132-3 sym-132-4 sym-132-5 sym-132-6 sym-132-7 sym-132-8 sym-132-9)
+'(sym-133-0 sym-133-1 sym-133-2 sym-133-3 sym-133-4 sym-133-5 sym-133-6 sym-133-7 sym-133-8 sym-133-9)
+'(sym-134-0 sym-134-1 sym-134-2 sym-134-3 sym-134-4 sym-134-5 sym-134-6 sym-134-7 sym-134-8 sym-134-9)
+'(sym-135-0 sym-135-1 sym-135-2 sym-135-3 sym-135-4 sym-135-5 sym-135-6 sym-135-7 sym-135-8 sym-135-9)
+'(sym-136-0 sym-136-1 sym-136-2 sym-136-3 sym-136-4 sym-136-5 sym-136-6 sym-136-7 sym-136-8 sym-136-9)
+'(sym-137-0 sym-137-1 sym-137-2 sym-137-3 sym-137-4 sym-137-5 sym-137-6 sym-137-7 sym-137-8 sym-137-9)
+'(sym-138-0 sym-138-1 sym-138-2 sym-138-3 sym-138-4 sym-138-5 sym-138-6 sym-138-7 sym-138-8 sym-138-9)
+'(sym-139-0 sym-139-1 sym-139-2 sym-139-3 sym-139-4 sym-139-5 sym-139-6 sym-139-7 sym-139-8 sym-139-9)
+'(sym-140-0 sym-140-1 sym-140-2 sym-140-3 sym-140-4 sym-140-5 sym-140-6 sym-140-7 sym-140-8 sym-140-9)
+'(sym-141-0 sym-141-1 sym-141-2 sym-141-3 sym-141-4 sym-141-5 sym-141-6 sym-141-7 sym-141-8 sym-141-9)
+'(sym-142-0 sym-142-1 sym-142-2 sym-142-3 sym-142-4 sym-142-5 sym-142-6 sym-142-7 sym-142-8 sym-142-9)
+'(sym-143-0 sym-143-1 sym-143-2 sym-143-3 sym-143-4 sym-143-5 sym-143-6 sym-143-7 sym-143-8 sym-143-9)
+'(sym-144-0 sym-144-1 sym-144-2 sym-144-3 sym-144-4 sym-144-5 sym-144-6 sym-144-7 sym-144-8 sym-144-9)
+'(sym-145-0 sym-145-1 sym-145-2 sym-145-3 sym-145-4 sym-145-5 sym-145-6 sym-145-7 sym-145-8 sym-145-9)
+'(sym-146-0 sym-146-1 sym-146-2 sym-146-3 sym-146-4 sym-146-5 sym-146-6 sym-146-7 sym-146-8 sym-146-9)
+'(sym-147-0 sym-147-1 sym-147-2 sym-147-3 sym-147-4 sym-147-5 sym-147-6 sym-147-7 sym-147-8 sym-147-9)
+'(sym-148-0 sym-148-1 sym-148-2 sym-148-3 sym-148-4 sym-148-5 sym-148-6 sym-148-7 sym-148-8 sym-148-9)
+'(sym-149-0 sym-149-1 sym-149-2 sym-149-3 sym-149-4 sym-149-5 sym-149-6 sym-149-7 sym-149-8 sym-149-9)
+'(sym-150-0 sym-150-1 sym-150-2 sym-150-3 sym-150-4 sym-150-5 sym-150-6 sym-150-7 sym-150-8 sym-150-9)
+'(sym-151-0 sym-151-1 sym-151-2 sym-151-3 sym-151-4 sym-151-5 sym-151-6 sym-151-7 sym-151-8 sym-151-9)
+'(sym-152-0 sym-152-1 sym-152-2 sym-152-3 sym-152-4 sym-152-5 sym-152-6 sym-152-7 sym-152-8 sym-152-9)
+'(sym-153-0 sym-153-1 sym-153-2 sym-153-3 sym-153-4 sym-153-5 sym-153-6 sym-153-7 sym-153-8 sym-153-9)
+'(sym-154-0 sym-154-1 sym-154-2 sym-154-3 sym-154-4 sym-154-5 sym-154-6 sym-154-7 sym-154-8 sym-154-9)
+'(sym-155-0 sym-155-1 sym-155-2 sym-155-3 sym-155-4 sym-155-5 sym-155-6 sym-155-7 sym-155-8 sym-155-9)
+'(sym-156-0 sym-156-1 sym-156-2 sym-156-3 sym-156-4 sym-156-5 sym-156-6 sym-156-7 sym-156-8 sym-156-9)
+'(sym-157-0 sym-157-1 sym-157-2 sym-157-3 sym-157-4 sym-157-5 sym-157-6 sym-157-7 sym-157-8 sym-157-9)
+'(sym-158-0 sym-158-1 sym-158-2 sym-158-3 sym-158-4 sym-158-5 sym-158-6 sym-158-7 sym-158-8 sym-158-9)
+'(sym-159-0 sym-159-1 sym-159-2 sym-159-3 sym-159-4 sym-159-5 sym-159-6 sym-159-7 sym-159-8 sym-159-9)
+'(sym-160-0 sym-160-1 sym-160-2 sym-160-3 sym-160-4 sym-160-5 sym-160-6 sym-160-7 sym-160-8 sym-160-9)
+'(sym-161-0 sym-161-1 sym-161-2 sym-161-3 sym-161-4 sym-161-5 sym-161-6 sym-161-7 sym-161-8 sym-161-9)
+'(sym-162-0 sym-162-1 sym-162-2 sym-162-3 sym-162-4 sym-162-5 sym-162-6 sym-162-7 sym-162-8 sym-162-9)
+'(sym-163-0 sym-163-1 sym-163-2 sym-163-3 sym-163-4 sym-163-5 sym-163-6 sym-163-7 sym-163-8 sym-163-9)
+'(sym-164-0 sym-164-1 sym-164-2 sym-164-3 sym-164-4 sym-164-5 sym-164-6 sym-164-7 sym-164-8 sym-164-9)
+'(sym-165-0 sym-165-1 sym-165-2 sym-165-3 sym-165-4 sym-165-5 sym-165-6 sym-165-7 sym-165-8 sym-165-9)
+'(sym-166-0 sym-166-1 sym-166-2 sym-166-3 sym-166-4 sym-166-5 sym-166-6 sym-166-7 sym-166-8 sym-166-9)
+'(sym-167-0 sym-167-1 sym-167-2 sym-167-3 sym-167-4 sym-167-5 sym-167-6 sym-167-7 sym-167-8 sym-167-9)
+'(sym-168-0 sym-168-1 sym-168-2 sym-168-3 sym-168-4 sym-168-5 sym-168-6 sym-168-7 sym-168-8 sym-168-9)
+'(sym-169-0 sym-169-1 sym-169-2 sym-169-3 sym-169-4 sym-169-5 sym-169-6 sym-169-7 sym-169-8 sym-169-9)
+'(sym-170-0 sym-170-1 sym-170-2 sym-170-3 sym-170-4 sym-170-5 sym-170-6 sym-170-7 sym-170-8 sym-170-9)
+'(sym-171-0 sym-171-1 sym-171-2 sym-171-3 sym-171-4 sym-171-5 sym-171-6 sym-171-7 sym-171-8 sym-171-9)
+'(sym-172-0 sym-172-1 sym-172-2 sym-172-3 sym-172-4 sym-172-5 sym-172-6 sym-172-7 sym-172-8 sym-172-9)
+'(sym-173-0 sym-173-1 sym-173-2 sym-173-3 sym-173-4 sym-173-5 sym-173-6 sym-173-7 sym-173-8 sym-173-9)
+'(sym-174-0 sym-174-1 sym-174-2 sym-174-3 sym-174-4 sym-174-5 sym-174-6 sym-174-7 sym-174-8 sym-174-9)
+'(sym-175-0 sym-175-1 sym-175-2 sym-175-3 sym-175-4 sym-175-5 sym-175-6 sym-175-7 sym-175-8 sym-175-9)
+'(sym-176-0 sym-176-1 sym-176-2 sym-176-3 sym-176-4 sym-176-5 sym-176-6 sym-176-7 sym-176-8 sym-176-9)
+'(sym-177-0 sym-177-1 sym-177-2 sym-177-3 sym-177-4 sym-177-5 sym-177-6 sym-177-7 sym-177-8 sym-177-9)
+'(sym-178-0 sym-178-1 sym-178-2 sym-178-3 sym-178-4 sym-178-5 sym-178-6 sym-178-7 sym-178-8 sym-178-9)
+'(sym-179-0 sym-179-1 sym-179-2 sym-179-3 sym-179-4 sym-179-5 sym-179-6 sym-179-7 sym-179-8 sym-179-9)
+'(sym-180-0 sym-180-1 sym-180-2 sym-180-3 sym-180-4 sym-180-5 sym-180-6 sym-180-7 sym-180-8 sym-180-9)
+'(sym-181-0 sym-181-1 sym-181-2 sym-181-3 sym-181-4 sym-181-5 sym-181-6 sym-181-7 sym-181-8 sym-181-9)
+'(sym-182-0 sym-182-1 sym-182-2 sym-182-3 sym-182-4 sym-182-5 sym-182-6 sym-182-7 sym-182-8 sym-182-9)
+'(sym-183-0 sym-183-1 sym-183-2 sym-183-3 sym-183-4 sym-183-5 sym-183-6 sym-183-7 sym-183-8 sym-183-9)
+'(sym-184-0 sym-184-1 sym-184-2 sym-184-3 sym-184-4 sym-184-5 sym-184-6 sym-184-7 sym-184-8 sym-184-9)
+'(sym-185-0 sym-185-1 sym-185-2 sym-185-3 sym-185-4 sym-185-5 sym-185-6 sym-185-7 sym-185-8 sym-185-9)
+'(sym-186-0 sym-186-1 sym-186-2 sym-186-3 sym-186-4 sym-186-5 sym-186-6 sym-186-7 sym-186-8 sym-186-9)
+'(sym-187-0 sym-187-1 sym-187-2 sym-187-3 sym-187-4 sym-187-5 sym-187-6 sym-187-7 sym-187-8 sym-187-9)
+'(sym-188-0 sym-188-1 sym-188-2 sym-188-3 sym-188-4 sym-188-5 sym-188-6 sym-188-7 sym-188-8 sym-188-9)
+'(sym-189-0 sym-189-1 sym-189-2 sym-189-3 sym-189-4 sym-189-5 sym-189-6 sym-189-7 sym-189-8 sym-189-9)
+'(sym-190-0 sym-190-1 sym-190-2 sym-190-3 sym-190-4 sym-190-5 sym-190-6 sym-190-7 sym-190-8 sym-190-9)
+'(sym-191-0 sym-191-1 sym-191-2 sym-191-3 sym-191-4 sym-191-5 sym-191-6 sym-191-7 sym-191-8 sym-191-9)
+'(sym-192-0 sym-192-1 sym-192-2 sym-192-3 sym-192-4 sym-192-5 sym-192-6 sym-192-7 sym-192-8 sym-192-9)
+'(sym-193-0 sym-193-1 sym-193-2 sym-193-3 sym-193-4 sym-193-5 sym-193-6 sym-193-7 sym-193-8 sym-193-9)
+'(sym-194-0 sym-194-1 sym-194-2 sym-194-3 sym-194-4 sym-194-5 sym-194-6 sym-194-7 sym-194-8 sym-194-9)
+'(sym-195-0 sym-195-1 sym-195-2 sym-195-3 sym-195-4 sym-195-5 sym-195-6 sym-195-7 sym-195-8 sym-195-9)
+'(sym-196-0 sym-196-1 sym-196-2 sym-196-3 sym-196-4 sym-196-5 sym-196-6 sym-196-7 sym-196-8 sym-196-9)
+'(sym-197-0 sym-197-1 sym-197-2 sym-197-3 sym-197-4 sym-197-5 sym-197-6 sym-197-7 sym-197-8 sym-197-9)
+'(sym-198-0 sym-198-1 sym-198-2 sym-198-3 sym-198-4 sym-198-5 sym-198-6 sym-198-7 sym-198-8 sym-198-9)
+'(sym-199-0 sym-199-1 sym-199-2 sym-199-3 sym-199-4 sym-199-5 sym-199-6 sym-199-7 sym-199-8 sym-199-9)
+'(sym-200-0 sym-200-1 sym-200-2 sym-200-3 sym-200-4 sym-200-5 sym-200-6 sym-200-7 sym-200-8 sym-200-9)
+'(sym-201-0 sym-201-1 sym-201-2 sym-201-3 sym-201-4 sym-201-5 sym-201-6 sym-201-7 sym-201-8 sym-201-9)
+'(sym-202-0 sym-202-1 sym-202-2 sym-202-3 sym-202-4 sym-202-5 sym-202-6 sym-202-7 sym-202-8 sym-202-9)
+'(sym-203-0 sym-203-1 sym-203-2 sym-203-3 sym-203-4 sym-203-5 sym-203-6 sym-203-7 sym-203-8 sym-203-9)
+'(sym-204-0 sym-204-1 sym-204-2 sym-204-3 sym-204-4 sym-204-5 sym-204-6 sym-204-7 sym-204-8 sym-204-9)
+'(sym-205-0 sym-205-1 sym-205-2 sym-205-3 sym-205-4 sym-205-5 sym-205-6 sym-205-7 sym-205-8 sym-205-9)
+'(sym-206-0 sym-206-1 sym-206-2 sym-206-3 sym-206-4 sym-206-5 sym-206-6 sym-206-7 sym-206-8 sym-206-9)
+'(sym-207-0 sym-207-1 sym-207-2 sym-207-3 sym-207-4 sym-207-5 sym-207-6 sym-207-7 sym-207-8 sym-207-9)
+'(sym-208-0 sym-208-1 sym-208-2 sym-208-3 sym-208-4 sym-208-5 sym-208-6 sym-208-7 sym-208-8 sym-208-9)
+'(sym-209-0 sym-209-1 sym-209-2 sym-209-3 sym-209-4 sym-209-5 sym-209-6 sym-209-7 sym-209-8 sym-209-9)
+'(sym-210-0 sym-210-1 sym-210-2 sym-210-3 sym-210-4 sym-210-5 sym-210-6 sym-210-7 sym-210-8 sym-210-9)
+'(sym-211-0 sym-211-1 sym-211-2 sym-211-3 sym-211-4 sym-211-5 sym-211-6 sym-211-7 sym-211-8 sym-211-9)
+'(sym-212-0 sym-212-1 sym-212-2 sym-212-3 sym-212-4 sym-212-5 sym-212-6 sym-212-7 sym-212-8 sym-212-9)
+'(sym-213-0 sym-213-1 sym-213-2 sym-213-3 sym-213-4 sym-213-5 sym-213-6 sym-213-7 sym-213-8 sym-213-9)
+'(sym-214-0 sym-214-1 sym-214-2 sym-214-3 sym-214-4 sym-214-5 sym-214-6 sym-214-7 sym-214-8 sym-214-9)
+'(sym-215-0 sym-215-1 sym-215-2 sym-215-3 sym-215-4 sym-215-5 sym-215-6 sym-215-7 sym-215-8 sym-215-9)
+'(sym-216-0 sym-216-1 sym-216-2 sym-216-3 sym-216-4 sym-216-5 sym-216-6 sym-216-7 sym-216-8 sym-216-9)
+'(sym-217-0 sym-217-1 sym-217-2 sym-217-3 sym-217-4 sym-217-5 sym-217-6 sym-217-7 sym-217-8 sym-217-9)
+'(sym-218-0 sym-218-1 sym-218-2 sym-218-3 sym-218-4 sym-218-5 sym-218-6 sym-218-7 sym-218-8 sym-218-9)
+'(sym-219-0 sym-219-1 sym-219-2 sym-219-3 sym-219-4 sym-219-5 sym-219-6 sym-219-7 sym-219-8 sym-219-9)
+'(sym-220-0 sym-220-1 sym-220-2 sym-220-3 sym-220-4 sym-220-5 sym-220-6 sym-220-7 sym-220-8 sym-220-9)
+'(sym-221-0 sym-221-1 sym-221-2 sym-221-3 sym-221-4 sym-221-5 sym-221-6 sym-221-7 sym-221-8 sym-221-9)
+'(sym-222-0 sym-222-1 sym-222-2 sym-222-3 sym-222-4 sym-222-5 sym-222-6 sym-222-7 sym-222-8 sym-222-9)
+'(sym-223-0 sym-223-1 sym-223-2 sym-223-3 sym-223-4 sym-223-5 sym-223-6 sym-223-7 sym-223-8 sym-223-9)
+'(sym-224-0 sym-224-1 sym-224-2 sym-224-3 sym-224-4 sym-224-5 sym-224-6 sym-224-7 sym-224-8 sym-224-9)
+'(sym-225-0 sym-225-1 sym-225-2 sym-225-3 sym-225-4 sym-225-5 sym-225-6 sym-225-7 sym-225-8 sym-225-9)
+'(sym-226-0 sym-226-1 sym-226-2 sym-226-3 sym-226-4 sym-226-5 sym-226-6 sym-226-7 sym-226-8 sym-226-9)
+'(sym-227-0 sym-227-1 sym-227-2 sym-227-3 sym-227-4 sym-227-5 sym-227-6 sym-227-7 sym-227-8 sym-227-9)
+'(sym-228-0 sym-228-1 sym-228-2 sym-228-3 sym-228-4 sym-228-5 sym-228-6 sym-228-7 sym-228-8 sym-228-9)
+'(sym-229-0 sym-229-1 sym-229-2 sym-229-3 sym-229-4 sym-229-5 sym-229-6 sym-229-7 sym-229-8 sym-229-9)
+'(sym-230-0 sym-230-1 sym-230-2 sym-230-3 sym-230-4 sym-230-5 sym-230-6 sym-230-7 sym-230-8 sym-230-9)
+'(sym-231-0 sym-231-1 sym-231-2 sym-231-3 sym-231-4 sym-231-5 sym-231-6 sym-231-7 sym-231-8 sym-231-9)
+'(sym-232-0 sym-232-1 sym-232-2 sym-232-3 sym-232-4 sym-232-5 sym-232-6 sym-232-7 sym-232-8 sym-232-9)
+'(sym-233-0 sym-233-1 sym-233-2 sym-233-3 sym-233-4 sym-233-5 sym-233-6 sym-233-7 sym-233-8 sym-233-9)
+'(sym-234-0 sym-234-1 sym-234-2 sym-234-3 sym-234-4 sym-234-5 sym-234-6 sym-234-7 sym-234-8 sym-234-9)
+'(sym-235-0 sym-235-1 sym-235-2 sym-235-3 sym-235-4 sym-235-5 sym-235-6 sym-235-7 sym-235-8 sym-235-9)
+'(sym-236-0 sym-236-1 sym-236-2 sym-236-3 sym-236-4 sym-236-5 sym-236-6 sym-236-7 sym-236-8 sym-236-9)
+'(sym-237-0 sym-237-1 sym-237-2 sym-237-3 sym-237-4 sym-237-5 sym-237-6 sym-237-7 sym-237-8 sym-237-9)
+'(sym-238-0 sym-238-1 sym-238-2 sym-238-3 sym-238-4 sym-238-5 sym-238-6 sym-238-7 sym-238-8 sym-238-9)
+'(sym-239-0 sym-239-1 sym-239-2 sym-239-3 sym-239-4 sym-239-5 sym-239-6 sym-239-7 sym-239-8 sym-239-9)
+'(sym-240-0 sym-240-1 sym-240-2 sym-240-3 sym-240-4 sym-240-5 sym-240-6 sym-240-7 sym-240-8 sym-240-9)
+'(sym-241-0 sym-241-1 sym-241-2 sym-241-3 sym-241-4 sym-241-5 sym-241-6 sym-241-7 sym-241-8 sym-241-9)
+'(sym-242-0 sym-242-1 sym-242-2 sym-242-3 sym-242-4 sym-242-5 sym-242-6 sym-242-7 sym-242-8 sym-242-9)
+'(sym-243-0 sym-243-1 sym-243-2 sym-243-3 sym-243-4 sym-243-5 sym-243-6 sym-243-7 sym-243-8 sym-243-9)
+'(sym-244-0 sym-244-1 sym-244-2 sym-244-3 sym-244-4 sym-244-5 sym-244-6 sym-244-7 sym-244-8 sym-244-9)
+'(sym-245-0 sym-245-1 sym-245-2 sym-245-3 sym-245-4 sym-245-5 sym-245-6 sym-245-7 sym-245-8 sym-245-9)
+'(sym-246-0 sym-246-1 sym-246-2 sym-246-3 sym-246-4 sym-246-5 sym-246-6 sym-246-7 sym-246-8 sym-246-9)
+'(sym-247-0 sym-247-1 sym-247-2 sym-247-3 sym-247-4 sym-247-5 sym-247-6 sym-247-7 sym-247-8 sym-247-9)
+'(sym-248-0 sym-248-1 sym-248-2 sym-248-3 sym-248-4 sym-248-5 sym-248-6 sym-248-7 sym-248-8 sym-248-9)
+'(sym-249-0 sym-249-1 sym-249-2 sym-249-3 sym-249-4 sym-249-5 sym-249-6 sym-249-7 sym-249-8 sym-249-9)
+'(sym-250-0 sym-250-1 sym-250-2 sym-250-3 sym-250-4 sym-250-5 sym-250-6 sym-250-7 sym-250-8 sym-250-9)
+'(sym-251-0 sym-251-1 sym-251-2 sym-251-3 sym-251-4 sym-251-5 sym-251-6 sym-251-7 sym-251-8 sym-251-9)
+'(sym-252-0 sym-252-1 sym-252-2 sym-252-3 sym-252-4 sym-252-5 sym-252-6 sym-252-7 sym-252-8 sym-252-9)
+'(sym-253-0 sym-253-1 sym-253-2 sym-253-3 sym-253-4 sym-253-5 sym-253-6 sym-253-7 sym-253-8 sym-253-9)
+'(sym-254-0 sym-254-1 sym-254-2 sym-254-3 sym-254-4 sym-254-5 sym-254-6 sym-254-7 sym-254-8 sym-254-9)
+'(sym-255-0 sym-255-1 sym-255-2 sym-255-3 sym-255-4 sym-255-5 sym-255-6 sym-255-7 sym-255-8 sym-255-9)
+'(sym-256-0 sym-256-1 sym-256-2 sym-256-3 sym-256-4 sym-256-5 sym-256-6 sym-256-7 sym-256-8 sym-256-9)
+'(sym-257-0 sym-257-1 sym-257-2 sym-257-3 sym-257-4 sym-257-5 sym-257-6 sym-257-7 sym-257-8 sym-257-9)
+'(sym-258-0 sym-258-1 sym-258-2 sym-258-3 sym-258-4 sym-258-5 sym-258-6 sym-258-7 sym-258-8 sym-258-9)
+'(sym-259-0 sym-259-1 sym-259-2 sym-259-3 sym-259-4 sym-259-5 sym-259-6 sym-259-7 sym-259-8 sym-259-9)
+'(sym-260-0 sym-260-1 sym-260-2 sym-260-3 sym-260-4 sym-260-5 sym-260-6 sym-260-7 sym-260-8 sym-260-9)
+'(sym-261-0 sym-261-1 sym-261-2 sym-261-3 sym-261-4 sym-261-5 sym-261-6 sym-261-7 sym-261-8 sym-261-9)
+'(sym-262-0 sym-262-1 sym-262-2 sym-262-3 sym-262-4 sym-262-5 sym-262-6 sym-262-7 sym-262-8 sym-262-9)
+'(sym-263-0 sym-263-1 sym-263-2 sym-263-3 sym-263-4 sym-263-5 sym-263-6 sym-263-7 sym-263-8 sym-263-9)
+'(sym-264-0 sym-264-1 sym-264-2 sym-264-3 sym-264-4 sym-264-5 sym-264-6 sym-264-7 sym-264-8 sym-264-9)
+'(sym-265-0 sym-265-1 sym-265-2 sym-265-3 sym-265-4 sym-265-5 sym-265-6 sym-265-7 sym-265-8 sym-265-9)
+'(sym-266-0 sym-266-1 sym-266-2 sym-266-3 sym-266-4 sym-266-5 sym-266-6 sym-266-7 sym-266-8 sym-266-9)
+'(sym-267-0 sym-267-1 sym-267-2 sym-267-3 sym-267-4 sym-267-5 sym-267-6 sym-267-7 sym-267-8 sym-267-9)
+'(sym-268-0 sym-268-1 sym-268-2 sym-268-3 sym-268-4 sym-268-5 sym-268-6 sym-268-7 sym-268-8 sym-268-9)
+'(sym-269-0 sym-269-1 sym-269-2 sym-269-3 sym-269-4 sym-269-5 sym-269-6 sym-269-7 sym-269-8 sym-269-9)
+'(sym-270-0 sym-270-1 sym-270-2 sym-270-3 sym-270-4 sym-270-5 sym-270-6 sym-270-7 sym-270-8 sym-270-9)
+'(sym-271-0 sym-271-1 sym-271-2 sym-271-3 sym-271-4 sym-271-5 sym-271-6 sym-271-7 sym-271-8 sym-271-9)
+'(sym-272-0 sym-272-1 sym-272-2 sym-272-3 sym-272-4 sym-272-5 sym-272-6 sym-272-7 sym-272-8 sym-272-9)
+'(sym-273-0 sym-273-1 sym-273-2 sym-273-3 sym-273-4 sym-273-5 sym-273-6 sym-273-7 sym-273-8 sym-273-9)
+'(sym-274-0 sym-274-1 sym-274-2 sym-274-3 sym-274-4 sym-274-5 sym-274-6 sym-274-7 sym-274-8 sym-274-9)
+'(sym-275-0 sym-275-1 sym-275-2 sym-275-3 sym-275-4 sym-275-5 sym-275-6 sym-275-7 sym-275-8 sym-275-9)
+'(sym-276-0 sym-276-1 sym-276-2 sym-276-3 sym-276-4 sym-276-5 sym-276-6 sym-276-7 sym-276-8 sym-276-9)
+'(sym-277-0 sym-277-1 sym-277-2 sym-277-3 sym-277-4 sym-277-5 sym-277-6 sym-277-7 sym-277-8 sym-277-9)
+'(sym-278-0 sym-278-1 sym-278-2 sym-278-3 sym-278-4 sym-278-5 sym-278-6 sym-278-7 sym-278-8 sym-278-9)
+'(sym-279-0 sym-279-1 sym-279-2 sym-279-3 sym-279-4 sym-279-5 sym-279-6 sym-279-7 sym-279-8 sym-279-9)
+'(sym-280-0 sym-280-1 sym-280-2 sym-280-3 sym-280-4 sym-280-5 sym-280-6 sym-280-7 sym-280-8 sym-280-9)
+'(sym-281-0 sym-281-1 sym-281-2 sym-281-3 sym-281-4 sym-281-5 sym-281-6 sym-281-7 sym-281-8 sym-281-9)
+'(sym-282-0 sym-282-1 sym-282-2 sym-282-3 sym-282-4 sym-282-5 sym-282-6 sym-282-7 sym-282-8 sym-282-9)
+'(sym-283-0 sym-283-1 sym-283-2 sym-283-3 sym-283-4 sym-283-5 sym-283-6 sym-283-7 sym-283-8 sym-283-9)
+'(sym-284-0 sym-284-1 sym-284-2 sym-284-3 sym-284-4 sym-284-5 sym-284-6 sym-284-7 sym-284-8 sym-284-9)
+'(sym-285-0 sym-285-1 sym-285-2 sym-285-3 sym-285-4 sym-285-5 sym-285-6 sym-285-7 sym-285-8 sym-285-9)
+'(sym-286-0 sym-286-1 sym-286-2 sym-286-3 sym-286-4 sym-286-5 sym-286-6 sym-286-7 sym-286-8 sym-286-9)
+'(sym-287-0 sym-287-1 sym-287-2 sym-287-3 sym-287-4 sym-287-5 sym-287-6 sym-287-7 sym-287-8 sym-287-9)
+'(sym-288-0 sym-288-1 sym-288-2 sym-288-3 sym-288-4 sym-288-5 sym-288-6 sym-288-7 sym-288-8 sym-288-9)
+'(sym-289-0 sym-289-1 sym-289-2 sym-289-3 sym-289-4 sym-289-5 sym-289-6 sym-289-7 sym-289-8 sym-289-9)
+'(sym-290-0 sym-290-1 sym-290-2 sym-290-3 sym-290-4 sym-290-5 sym-290-6 sym-290-7 sym-290-8 sym-290-9)
+'(sym-291-0 sym-291-1 sym-291-2 sym-291-3 sym-291-4 sym-291-5 sym-291-6 sym-291-7 sym-291-8 sym-291-9)
+'(sym-292-0 sym-292-1 sym-292-2 sym-292-3 sym-292-4 sym-292-5 sym-292-6 sym-292-7 sym-292-8 sym-292-9)
+'(sym-293-0 sym-293-1 sym-293-2 sym-293-3 sym-293-4 sym-293-5 sym-293-6 sym-293-7 sym-293-8 sym-293-9)
+'(sym-294-0 sym-294-1 sym-294-2 sym-294-3 sym-294-4 sym-294-5 sym-294-6 sym-294-7 sym-294-8 sym-294-9)
+'(sym-295-0 sym-295-1 sym-295-2 sym-295-3 sym-295-4 sym-295-5 sym-295-6 sym-295-7 sym-295-8 sym-295-9)
+'(sym-296-0 sym-296-1 sym-296-2 sym-296-3 sym-296-4 sym-296-5 sym-296-6 sym-296-7 sym-296-8 sym-296-9)
+'(sym-297-0 sym-297-1 sym-297-2 sym-297-3 sym-297-4 sym-297-5 sym-297-6 sym-297-7 sym-297-8 sym-297-9)
+'(sym-298-0 sym-298-1 sym-298-2 sym-298-3 sym-298-4 sym-298-5 sym-298-6 sym-298-7 sym-298-8 sym-298-9)
+'(sym-299-0 sym-299-1 sym-299-2 sym-299-3 sym-299-4 sym-299-5 sym-299-6 sym-299-7 sym-299-8 sym-299-9)
+'(sym-300-0 sym-300-1 sym-300-2 sym-300-3 sym-300-4 sym-300-5 sym-300-6 sym-300-7 sym-300-8 sym-300-9)
+'(sym-301-0 sym-301-1 sym-301-2 sym-301-3 sym-301-4 sym-301-5 sym-301-6 sym-301-7 sym-301-8 sym-301-9)
+'(sym-302-0 sym-302-1 sym-302-2 sym-302-3 sym-302-4 sym-302-5 sym-302-6 sym-302-7 sym-302-8 sym-302-9)
+'(sym-303-0 sym-303-1 sym-303-2 sym-303-3 sym-303-4 sym-303-5 sym-303-6 sym-303-7 sym-303-8 sym-303-9)
+'(sym-304-0 sym-304-1 sym-304-2 sym-304-3 sym-304-4 sym-304-5 sym-304-6 sym-304-7 sym-304-8 sym-304-9)
+'(sym-305-0 sym-305-1 sym-305-2 sym-305-3 sym-305-4 sym-305-5 sym-305-6 sym-305-7 sym-305-8 sym-305-9)
+'(sym-306-0 sym-306-1 sym-306-2 sym-306-3 sym-306-4 sym-306-5 sym-306-6 sym-306-7 sym-306-8 sym-306-9)
+'(sym-307-0 sym-307-1 sym-307-2 sym-307-3 sym-307-4 sym-307-5 sym-307-6 sym-307-7 sym-307-8 sym-307-9)
+'(sym-308-0 sym-308-1 sym-308-2 sym-308-3 sym-308-4 sym-308-5 sym-308-6 sym-308-7 sym-308-8 sym-308-9)
+'(sym-309-0 sym-309-1 sym-309-2 sym-309-3 sym-309-4 sym-309-5 sym-309-6 sym-309-7 sym-309-8 sym-309-9)
+'(sym-310-0 sym-310-1 sym-310-2 sym-310-3 sym-310-4 sym-310-5 sym-310-6 sym-310-7 sym-310-8 sym-310-9)
+'(sym-311-0 sym-311-1 sym-311-2 sym-311-3 sym-311-4 sym-311-5 sym-311-6 sym-311-7 sym-311-8 sym-311-9)
+'(sym-312-0 sym-312-1 sym-312-2 sym-312-3 sym-312-4 sym-312-5 sym-312-6 sym-312-7 sym-312-8 sym-312-9)
+'(sym-313-0 sym-313-1 sym-313-2 sym-313-3 sym-313-4 sym-313-5 sym-313-6 sym-313-7 sym-313-8 sym-313-9)
+'(sym-314-0 sym-314-1 sym-314-2 sym-314-3 sym-314-4 sym-314-5 sym-314-6 sym-314-7 sym-314-8 sym-314-9)
+'(sym-315-0 sym-315-1 sym-315-2 sym-315-3 sym-315-4 sym-315-5 sym-315-6 sym-315-7 sym-315-8 sym-315-9)
+'(sym-316-0 sym-316-1 sym-316-2 sym-316-3 sym-316-4 sym-316-5 sym-316-6 sym-316-7 sym-316-8 sym-316-9)
+'(sym-317-0 sym-317-1 sym-317-2 sym-317-3 sym-317-4 sym-317-5 sym-317-6 sym-317-7 sym-317-8 sym-317-9)
+'(sym-318-0 sym-318-1 sym-318-2 sym-318-3 sym-318-4 sym-318-5 sym-318-6 sym-318-7 sym-318-8 sym-318-9)
+'(sym-319-0 sym-319-1 sym-319-2 sym-319-3 sym-319-4 sym-319-5 sym-319-6 sym-319-7 sym-319-8 sym-319-9)
+'(sym-320-0 sym-320-1 sym-320-2 sym-320-3 sym-320-4 sym-320-5 sym-320-6 sym-320-7 sym-320-8 sym-320-9)
+'(sym-321-0 sym-321-1 sym-321-2 sym-321-3 sym-321-4 sym-321-5 sym-321-6 sym-321-7 sym-321-8 sym-321-9)
+'(sym-322-0 sym-322-1 sym-322-2 sym-322-3 sym-322-4 sym-322-5 sym-322-6 sym-322-7 sym-322-8 sym-322-9)
+'(sym-323-0 sym-323-1 sym-323-2 sym-323-3 sym-323-4 sym-323-5 sym-323-6 sym-323-7 sym-323-8 sym-323-9)
+'(sym-324-0 sym-324-1 sym-324-2 sym-324-3 sym-324-4 sym-324-5 sym-324-6 sym-324-7 sym-324-8 sym-324-9)
+'(sym-325-0 sym-325-1 sym-325-2 sym-325-3 sym-325-4 sym-325-5 sym-325-6 sym-325-7 sym-325-8 sym-325-9)
+'(sym-326-0 sym-326-1 sym-326-2 sym-326-3 sym-326-4 sym-326-5 sym-326-6 sym-326-7 sym-326-8 sym-326-9)
+'(sym-327-0 sym-327-1 sym-327-2 sym-327-3 sym-327-4 sym-327-5 sym-327-6 sym-327-7 sym-327-8 sym-327-9)
+'(sym-328-0 sym-328-1 sym-328-2 sym-328-3 sym-328-4 sym-328-5 sym-328-6 sym-328-7 sym-328-8 sym-328-9)
+'(sym-329-0 sym-329-1 sym-329-2 sym-329-3 sym-329-4 sym-329-5 sym-329-6 sym-329-7 sym-329-8 sym-329-9)
+'(sym-330-0 sym-330-1 sym-330-2 sym-330-3 sym-330-4 sym-330-5 sym-330-6 sym-330-7 sym-330-8 sym-330-9)
+'(sym-331-0 sym-331-1 sym-331-2 sym-331-3 sym-331-4 sym-331-5 sym-331-6 sym-331-7 sym-331-8 sym-331-9)
+'(sym-332-0 sym-332-1 sym-332-2 sym-332-3 sym-332-4 sym-332-5 sym-332-6 sym-332-7 sym-332-8 sym-332-9)
+'(sym-333-0 sym-333-1 sym-333-2 sym-333-3 sym-333-4 sym-333-5 sym-333-6 sym-333-7 sym-333-8 sym-333-9)
+'(sym-334-0 sym-334-1 sym-334-2 sym-334-3 sym-334-4 sym-334-5 sym-334-6 sym-334-7 sym-334-8 sym-334-9)
+'(sym-335-0 sym-335-1 sym-335-2 sym-335-3 sym-335-4 sym-335-5 sym-335-6 sym-335-7 sym-335-8 sym-335-9)
+'(sym-336-0 sym-336-1 sym-336-2 sym-336-3 sym-336-4 sym-336-5 sym-336-6 sym-336-7 sym-336-8 sym-336-9)
+'(sym-337-0 sym-337-1 sym-337-2 sym-337-3 sym-337-4 sym-337-5 sym-337-6 sym-337-7 sym-337-8 sym-337-9)
+'(sym-338-0 sym-338-1 sym-338-2 sym-338-3 sym-338-4 sym-338-5 sym-338-6 sym-338-7 sym-338-8 sym-338-9)
+'(sym-339-0 sym-339-1 sym-339-2 sym-339-3 sym-339-4 sym-339-5 sym-339-6 sym-339-7 sym-339-8 sym-339-9)
+'(sym-340-0 sym-340-1 sym-340-2 sym-340-3 sym-340-4 sym-340-5 sym-340-6 sym-340-7 sym-340-8 sym-340-9)
+'(sym-341-0 sym-341-1 sym-341-2 sym-341-3 sym-341-4 sym-341-5 sym-341-6 sym-341-7 sym-341-8 sym-341-9)
+'(sym-342-0 sym-342-1 sym-342-2 sym-342-3 sym-342-4 sym-342-5 sym-342-6 sym-342-7 sym-342-8 sym-342-9)
+'(sym-343-0 sym-343-1 sym-343-2 sym-343-3 sym-343-4 sym-343-5 sym-343-6 sym-343-7 sym-343-8 sym-343-9)
+'(sym-344-0 sym-344-1 sym-344-2 sym-344-3 sym-344-4 sym-344-5 sym-344-6 sym-344-7 sym-344-8 sym-344-9)
+'(sym-345-0 sym-345-1 sym-345-2 sym-345-3 sym-345-4 sym-345-5 sym-345-6 sym-345-7 sym-345-8 sym-345-9)
+'(sym-346-0 sym-346-1 sym-346-2 sym-346-3 sym-346-4 sym-346-5 sym-346-6 sym-346-7 sym-346-8 sym-346-9)
+'(sym-347-0 sym-347-1 sym-347-2 sym-347-3 sym-347-4 sym-347-5 sym-347-6 sym-347-7 sym-347-8 sym-347-9)
+'(sym-348-0 sym-348-1 sym-348-2 sym-348-3 sym-348-4 sym-348-5 sym-348-6 sym-348-7 sym-348-8 sym-348-9)
+'(sym-349-0 sym-349-1 sym-349-2 sym-349-3 sym-349-4 sym-349-5 sym-349-6 sym-349-7 sym-349-8 sym-349-9)
+'(sym-350-0 sym-350-1 sym-350-2 sym-350-3 sym-350-4 sym-350-5 sym-350-6 sym-350-7 sym-350-8 sym-350-9)
+'(sym-351-0 sym-351-1 sym-351-2 sym-351-3 sym-351-4 sym-351-5 sym-351-6 sym-351-7 sym-351-8 sym-351-9)
+'(sym-352-0 sym-352-1 sym-352-2 sym-352-3 sym-352-4 sym-352-5 sym-352-6 sym-352-7 sym-352-8 sym-352-9)
+'(sym-353-0 sym-353-1 sym-353-2 sym-353-3 sym-353-4 sym-353-5 sym-353-6 sym-353-7 sym-353-8 sym-353-9)
+'(sym-354-0 sym-354-1 sym-354-2 sym-354-3 sym-354-4 sym-354-5 sym-354-6 sym-354-7 sym-354-8 sym-354-9)
+'(sym-355-0 sym-355-1 sym-355-2 sym-355-3 sym-355-4 sym-355-5 sym-355-6 sym-355-7 sym-355-8 sym-355-9)
+'(sym-356-0 sym-356-1 sym-356-2 sym-356-3 sym-356-4 sym-356-5 sym-356-6 sym-356-7 sym-356-8 sym-356-9)
+'(sym-357-0 sym-357-1 sym-357-2 sym-357-3 sym-357-4 sym-357-5 sym-357-6 sym-357-7 sym-357-8 sym-357-9)
+'(sym-358-0 sym-358-1 sym-358-2 sym-358-3 sym-358-4 sym-358-5 sym-358-6 sym-358-7 sym-358-8 sym-358-9)
+'(sym-359-0 sym-359-1 sym-359-2 sym-359-3 sym-359-4 sym-359-5 sym-359-6 sym-359-7 sym-359-8 sym-359-9)
+'(sym-360-0 sym-360-1 sym-360-2 sym-360-3 sym-360-4 sym-360-5 sym-360-6 sym-360-7 sym-360-8 sym-360-9)
+'(sym-361-0 sym-361-1 sym-361-2 sym-361-3 sym-361-4 sym-361-5 sym-361-6 sym-361-7 sym-361-8 sym-361-9)
+'(sym-362-0 sym-362-1 sym-362-2 sym-362-3 sym-362-4 sym-362-5 sym-362-6 sym-362-7 sym-362-8 sym-362-9)
+'(sym-363-0 sym-363-1 sym-363-2 sym-363-3 sym-363-4 sym-363-5 sym-363-6 sym-363-7 sym-363-8 sym-363-9)
+'(sym-364-0 sym-364-1 sym-364-2 sym-364-3 sym-364-4 sym-364-5 sym-364-6 sym-364-7 sym-364-8 sym-364-9)
+'(sym-365-0 sym-365-1 sym-365-2 sym-365-3 sym-365-4 sym-365-5 sym-365-6 sym-365-7 sym-365-8 sym-365-9)
+'(sym-366-0 sym-366-1 sym-366-2 sym-366-3 sym-366-4 sym-366-5 sym-366-6 sym-366-7 sym-366-8 sym-366-9)
+'(sym-367-0 sym-367-1 sym-367-2 sym-367-3 sym-367-4 sym-367-5 sym-367-6 sym-367-7 sym-367-8 sym-367-9)
+'(sym-368-0 sym-368-1 sym-368-2 sym-368-3 sym-368-4 sym-368-5 sym-368-6 sym-368-7 sym-368-8 sym-368-9)
+'(sym-369-0 sym-369-1 sym-369-2 sym-369-3 sym-369-4 sym-369-5 sym-369-6 sym-369-7 sym-369-8 sym-369-9)
+'(sym-370-0 sym-370-1 sym-370-2 sym-370-3 sym-370-4 sym-370-5 sym-370-6 sym-370-7 sym-370-8 sym-370-9)
+'(sym-371-0 sym-371-1 sym-371-2 sym-371-3 sym-371-4 sym-371-5 sym-371-6 sym-371-7 sym-371-8 sym-371-9)
+'(sym-372-0 sym-372-1 sym-372-2 sym-372-3 sym-372-4 sym-372-5 sym-372-6 sym-372-7 sym-372-8 sym-372-9)
+'(sym-373-0 sym-373-1 sym-373-2 sym-373-3 sym-373-4 sym-373-5 sym-373-6 sym-373-7 sym-373-8 sym-373-9)
+'(sym-374-0 sym-374-1 sym-374-2 sym-374-3 sym-374-4 sym-374-5 sym-374-6 sym-374-7 sym-374-8 sym-374-9)
+'(sym-375-0 sym-375-1 sym-375-2 sym-375-3 sym-375-4 sym-375-5 sym-375-6 sym-375-7 sym-375-8 sym-375-9)
+'(sym-376-0 sym-376-1 sym-376-2 sym-376-3 sym-376-4 sym-376-5 sym-376-6 sym-376-7 sym-376-8 sym-376-9)
+'(sym-377-0 sym-377-1 sym-377-2 sym-377-3 sym-377-4 sym-377-5 sym-377-6 sym-377-7 sym-377-8 sym-377-9)
+'(sym-378-0 sym-378-1 sym-378-2 sym-378-3 sym-378-4 sym-378-5 sym-378-6 sym-378-7 sym-378-8 sym-378-9)
+'(sym-379-0 sym-379-1 sym-379-2 sym-379-3 sym-379-4 sym-379-5 sym-379-6 sym-379-7 sym-379-8 sym-379-9)
+'(sym-380-0 sym-380-1 sym-380-2 sym-380-3 sym-380-4 sym-380-5 sym-380-6 sym-380-7 sym-380-8 sym-380-9)
+'(sym-381-0 sym-381-1 sym-381-2 sym-381-3 sym-381-4 sym-381-5 sym-381-6 sym-381-7 sym-381-8 sym-381-9)
+'(sym-382-0 sym-382-1 sym-382-2 sym-382-3 sym-382-4 sym-382-5 sym-382-6 sym-382-7 sym-382-8 sym-382-9)
+'(sym-383-0 sym-383-1 sym-383-2 sym-383-3 sym-383-4 sym-383-5 sym-383-6 sym-383-7 sym-383-8 sym-383-9)
+'(sym-384-0 sym-384-1 sym-384-2 sym-384-3 sym-384-4 sym-384-5 sym-384-6 sym-384-7 sym-384-8 sym-384-9)
+'(sym-385-0 sym-385-1 sym-385-2 sym-385-3 sym-385-4 sym-385-5 sym-385-6 sym-385-7 sym-385-8 sym-385-9)
+'(sym-386-0 sym-386-1 sym-386-2 sym-386-3 sym-386-4 sym-386-5 sym-386-6 sym-386-7 sym-386-8 sym-386-9)
+'(sym-387-0 sym-387-1 sym-387-2 sym-387-3 sym-387-4 sym-387-5 sym-387-6 sym-387-7 sym-387-8 sym-387-9)
+'(sym-388-0 sym-388-1 sym-388-2 sym-388-3 sym-388-4 sym-388-5 sym-388-6 sym-388-7 sym-388-8 sym-388-9)
+'(sym-389-0 sym-389-1 sym-389-2 sym-389-3 sym-389-4 sym-389-5 sym-389-6 sym-389-7 sym-389-8 sym-389-9)
+'(sym-390-0 sym-390-1 sym-390-2 sym-390-3 sym-390-4 sym-390-5 sym-390-6 sym-390-7 sym-390-8 sym-390-9)
+'(sym-391-0 sym-391-1 sym-391-2 sym-391-3 sym-391-4 sym-391-5 sym-391-6 sym-391-7 sym-391-8 sym-391-9)
+'(sym-392-0 sym-392-1 sym-392-2 sym-392-3 sym-392-4 sym-392-5 sym-392-6 sym-392-7 sym-392-8 sym-392-9)
+'(sym-393-0 sym-393-1 sym-393-2 sym-393-3 sym-393-4 sym-393-5 sym-393-6 sym-393-7 sym-393-8 sym-393-9)
+'(sym-394-0 sym-394-1 sym-394-2 sym-394-3 sym-394-4 sym-394-5 sym-394-6 sym-394-7 sym-394-8 sym-394-9)
+'(sym-395-0 sym-395-1 sym-395-2 sym-395-3 sym-395-4 sym-395-5 sym-395-6 sym-395-7 sym-395-8 sym-395-9)
+'(sym-396-0 sym-396-1 sym-396-2 sym-396-3 sym-396-4 sym-396-5 sym-396-6 sym-396-7 sym-396-8 sym-396-9)
+'(sym-397-0 sym-397-1 sym-397-2 sym-397-3 sym-397-4 sym-397-5 sym-397-6 sym-397-7 sym-397-8 sym-397-9)
+'(sym-398-0 sym-398-1 sym-398-2 sym-398-3 sym-398-4 sym-398-5 sym-398-6 sym-398-7 sym-398-8 sym-398-9)
+'(sym-399-0 sym-399-1 sym-399-2 sym-399-3 sym-399-4 sym-399-5 sym-399-6 sym-399-7 sym-399-8 sym-399-9)
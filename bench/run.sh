@@ -0,0 +1,46 @@
+#!/bin/sh
+#
+# JCM-LISP benchmark runner.
+#
+# Usage: bench/run.sh BINARY WORKLOAD.lsp...
+#
+# Feeds each workload to BINARY (built with -DGC_STATS) on stdin
+# BENCH_REPEAT times (default 5) and prints one CSV row per run:
+#
+#   benchmark,run,wall_ms,allocs,gc_count,gc_ms,max_rss_kb,max_live
+#
+# max_live is the most heap objects any collection kept (0 if none ran).
+#
+# With BENCH_MODE=batch the workload is passed as a file argument
+# instead, which runs it without the REPL's output.  Interpreter output is discarded.  A run that exits non-zero or
+# prints no stats line is reported on stderr and fails the script.
+
+BIN=${1:?usage: bench/run.sh BINARY WORKLOAD.lsp...}
+shift
+REPEAT=${BENCH_REPEAT:-5}
+MODE=${BENCH_MODE:-repl}
+STATUS=0
+
+echo "benchmark,run,wall_ms,allocs,gc_count,gc_ms,max_rss_kb,max_live"
+
+for workload in "$@"; do
+  name=$(basename "$workload" .lsp)
+  run=1
+  while [ "$run" -le "$REPEAT" ]; do
+    if [ "$MODE" = batch ]; then
+      stats=$("$BIN" "$workload" 2>&1 >/dev/null | grep '^stats ')
+    else
+      stats=$("$BIN" < "$workload" 2>&1 >/dev/null | grep '^stats ')
+    fi
+    if [ -z "$stats" ]; then
+      echo "$name: run $run failed" >&2
+      STATUS=1
+      break
+    fi
+    echo "$stats" | sed -e "s/^stats /$name,$run,/" \
+                        -e 's/ *[a-z_]*=/,/g' -e 's/,,/,/'
+    run=$((run + 1))
+  done
+done
+
+exit $STATUS
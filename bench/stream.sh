@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# JCM-LISP streaming benchmark.
+#
+# Usage: bench/stream.sh BINARY [MB]
+#
+# Generates an s-expression data file of about MB megabytes (default
+# 1024) and one a sixteenth of the size, sums a field over every record
+# of each with for-each-form, and prints one CSV row per file:
+#
+#   size_mb,records,wall_ms,mb_per_sec,gc_count,max_rss_kb
+#
+# Peak memory should not grow with the file.  BINARY must be built
+# with -DGC_STATS.  The data goes under TMPDIR and is removed after.
+
+BIN=${1:?usage: bench/stream.sh BINARY [MB]}
+MB=${2:-1024}
+
+TMP=${TMPDIR:-/tmp}/jcm-stream.$$
+trap 'rm -rf "$TMP"' EXIT
+mkdir -p "$TMP"
+
+echo "size_mb,records,wall_ms,mb_per_sec,gc_count,max_rss_kb"
+
+for size in $((MB / 16)) "$MB"; do
+  [ "$size" -gt 0 ] || continue
+  data="$TMP/data-$size.lsp"
+
+  awk -v bytes=$((size * 1048576)) 'BEGIN {
+    for (i = 0; n < bytes; i++) {
+      line = sprintf("(record %d \"name-%d\" (%d %d %d) tag)",
+                     i, i % 1000, i % 7, i % 11, i % 13)
+      print line
+      n += length(line) + 1
+    }
+  }' > "$data"
+
+  cat > "$TMP/sum.lsp" <<LISP
+(define total 0)
+(print (for-each-form "$data" (lambda (r) (setq total (+ total (car (cdr r)))))))
+LISP
+
+  out=$("$BIN" "$TMP/sum.lsp" 2>&1) || { echo "$BIN failed on $data" >&2; exit 1; }
+  records=$(echo "$out" | head -n 1)
+  echo "$out" | grep '^stats ' |
+    awk -v size="$size" -v records="$records" '{
+      for (i = 2; i <= NF; i++) { split($i, kv, "="); s[kv[1]] = kv[2] }
+      printf "%d,%d,%.0f,%.2f,%d,%d\n", size, records, s["wall_ms"],
+             size * 1000 / s["wall_ms"], s["gc_count"], s["max_rss_kb"]
+    }'
+  rm -f "$data"
+done
@@ -0,0 +1,14 @@
+; Sum a million numbers held in an unboxed array, through array-sum.
+; Same setup as sum-list.lsp; only the summing differs.
+(define a (array-iota 'int64 1000000))
+(car (define xs (array->list a)))
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
+(array-sum a)
@@ -0,0 +1,14 @@
+; Sum a million numbers held in a list, through +.
+; Same setup as sum-array.lsp; only the summing differs.
+(define a (array-iota 'int64 1000000))
+(car (define xs (array->list a)))
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
+(apply + xs)
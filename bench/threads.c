@@ -0,0 +1,88 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Interpreter throughput on 1..N threads.
+ *
+ * Usage: threads SCRIPT.lsp [MAX_THREADS] [RUNS_PER_THREAD]
+ *
+ * Each thread creates its own interpreter, loads SCRIPT into it
+ * RUNS_PER_THREAD times (a fresh interpreter per run), and frees it.
+ * Interpreter output is discarded.  Prints one CSV row per thread
+ * count:
+ *
+ *   threads,runs,wall_ms,runs_per_sec
+ *
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "../jcm-lisp.h"
+#include "../gc.h"
+
+#define THREADS_HEAP_SIZE  (1 << 18)
+
+static char *script;
+static int runs_per_thread;
+
+void *run_thread(void *arg) {
+  for (int i = 0; i < runs_per_thread; i++) {
+    struct Interp *in = interp_new(THREADS_HEAP_SIZE);
+
+    if (load_file(script) == NULL)
+      error("threads: cannot load script");
+
+    interp_free(in);
+  }
+
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s SCRIPT.lsp [MAX_THREADS] [RUNS_PER_THREAD]\n", argv[0]);
+    return 2;
+  }
+
+  script = argv[1];
+  int max_threads = argc > 2 ? atoi(argv[2]) : 4;
+  runs_per_thread = argc > 3 ? atoi(argv[3]) : 4;
+
+  if (max_threads < 1 || runs_per_thread < 1) {
+    fprintf(stderr, "threads: counts must be positive\n");
+    return 2;
+  }
+
+  pthread_t *threads = malloc(max_threads * sizeof(pthread_t));
+  assert(threads != NULL);
+
+  // The interpreters print to stdout, so results go to a copy of it.
+  FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+
+  if (out == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+    fprintf(stderr, "threads: cannot discard output\n");
+    return 1;
+  }
+
+  fprintf(out, "threads,runs,wall_ms,runs_per_sec\n");
+
+  for (int n = 1; n <= max_threads; n++) {
+    double start = now_seconds();
+
+    for (int t = 0; t < n; t++)
+      pthread_create(&threads[t], NULL, run_thread, NULL);
+    for (int t = 0; t < n; t++)
+      pthread_join(threads[t], NULL);
+
+    double wall = now_seconds() - start;
+    int runs = n * runs_per_thread;
+
+    fprintf(out, "%d,%d,%.3f,%.2f\n", n, runs, wall * 1000, runs / wall);
+    fflush(out);
+  }
+
+  free(threads);
+  fclose(out);
+  return 0;
+}
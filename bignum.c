@@ -0,0 +1,577 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Arbitrary precision integers.
+ *
+ * A BIGNUM holds a sign and a magnitude of little-endian 32 bit
+ * limbs with no leading zeros.  Results that fit in a fixnum are
+ * always returned as fixnums, so a BIGNUM is never in fixnum range.
+ *
+ * All arithmetic is done on malloc'd limb arrays, and the result is
+ * boxed with a single allocation at the end.  That way a GC triggered
+ * by the allocation can never free an operand in use.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "hash.h"
+#include "bignum.h"
+#include "alloc.h"
+
+/* A number unpacked for arithmetic.  A fixnum uses SMALL as its limbs;
+ * a bignum points at its own.
+ */
+struct Big {
+  uint32_t *d;
+  int len;
+  int neg;
+  uint32_t small[2];
+};
+
+int mag_trim(uint32_t *d, int len) {
+  while (len > 0 && d[len - 1] == 0)
+    len--;
+
+  return len;
+}
+
+void big_load(struct Big *b, Object *n) {
+  if (is_fixnum(n)) {
+    long v = fixnum_value(n);
+    unsigned long m = v < 0 ? -(unsigned long)v : (unsigned long)v;
+
+    b->neg = v < 0;
+    b->small[0] = (uint32_t)m;
+    b->small[1] = (uint32_t)(m >> 32);
+    b->d = b->small;
+    b->len = mag_trim(b->small, 2);
+  } else {
+    b->d = n->big.digits;
+    b->len = n->big.len;
+    b->neg = n->big.neg;
+  }
+}
+
+/* Box a malloc'd magnitude: a fixnum if it fits, otherwise a BIGNUM
+ * that takes ownership of D.
+ */
+Object *big_box(uint32_t *d, int len, int neg) {
+  len = mag_trim(d, len);
+
+  if (len <= 2) {
+    unsigned long m = 0;
+
+    if (len > 0)
+      m = d[0];
+    if (len > 1)
+      m |= (unsigned long)d[1] << 32;
+
+    if (m <= (unsigned long)FIXNUM_MAX ||
+        (neg && m == (unsigned long)FIXNUM_MAX + 1)) {
+      free(d);
+      return make_fixnum(neg ? -(long)(m - 1) - 1 : (long)m);
+    }
+  }
+
+  Object *obj = NULL;
+
+  pin_variable((void **)&obj);
+  obj = new_Object(BIGNUM);
+  obj->big.digits = d;
+  obj->big.len = len;
+  obj->big.neg = neg;
+  alloc_track_bytes(len * sizeof(uint32_t));
+  unpin_variable((void **)&obj);
+  return obj;
+}
+
+/* Only called by make_fixnum() for values outside fixnum range. */
+Object *bignum_from_long(long n) {
+  unsigned long m = n < 0 ? -(unsigned long)n : (unsigned long)n;
+  uint32_t *d = malloc(2 * sizeof(uint32_t));
+
+  assert(d != NULL);
+  d[0] = (uint32_t)m;
+  d[1] = (uint32_t)(m >> 32);
+  return big_box(d, 2, n < 0);
+}
+
+/* A copy of N in the current heap. */
+Object *bignum_copy(Object *n) {
+  uint32_t *d = malloc(n->big.len * sizeof(uint32_t));
+
+  assert(d != NULL);
+  memcpy(d, n->big.digits, n->big.len * sizeof(uint32_t));
+  return big_box(d, n->big.len, n->big.neg);
+}
+
+/* The value of N in *OUT if it fits in a long; returns 0 if not. */
+int bignum_to_long(Object *n, long *out) {
+  unsigned long m = 0;
+
+  if (n->big.len > 2)
+    return 0;
+  if (n->big.len > 0)
+    m = n->big.digits[0];
+  if (n->big.len > 1)
+    m |= (unsigned long)n->big.digits[1] << 32;
+
+  if (m <= (unsigned long)LONG_MAX)
+    *out = n->big.neg ? -(long)m : (long)m;
+  else if (n->big.neg && m == (unsigned long)LONG_MAX + 1)
+    *out = LONG_MIN;
+  else
+    return 0;
+
+  return 1;
+}
+
+void bignum_free(Object *n) {
+  free(n->big.digits);
+  n->big.digits = NULL;
+  n->big.len = 0;
+}
+
+unsigned long bignum_hash(Object *n) {
+  return hash_bytes((char *)n->big.digits, n->big.len * sizeof(uint32_t)) ^ n->big.neg;
+}
+
+int mag_compare(uint32_t *a, int an, uint32_t *b, int bn) {
+  if (an != bn)
+    return an < bn ? -1 : 1;
+
+  for (int i = an - 1; i >= 0; i--) {
+    if (a[i] != b[i])
+      return a[i] < b[i] ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/* R needs room for max(AN, BN) + 1 limbs. */
+int mag_add(uint32_t *r, uint32_t *a, int an, uint32_t *b, int bn) {
+  if (an < bn) {
+    uint32_t *t = a; a = b; b = t;
+    int tn = an; an = bn; bn = tn;
+  }
+
+  uint64_t carry = 0;
+  int i;
+
+  for (i = 0; i < bn; i++) {
+    carry += (uint64_t)a[i] + b[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+
+  for (; i < an; i++) {
+    carry += a[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+
+  r[i] = (uint32_t)carry;
+  return an + 1;
+}
+
+/* R = A - B where A >= B and AN >= BN.  R may alias A. */
+int mag_sub(uint32_t *r, uint32_t *a, int an, uint32_t *b, int bn) {
+  int64_t borrow = 0;
+  int i;
+
+  for (i = 0; i < bn; i++) {
+    int64_t t = (int64_t)a[i] - b[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = t < 0;
+  }
+
+  for (; i < an; i++) {
+    int64_t t = (int64_t)a[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = t < 0;
+  }
+
+  return mag_trim(r, an);
+}
+
+/* R[0..RN) += T[0..TN); the sum must fit in RN limbs. */
+void mag_add_into(uint32_t *r, int rn, uint32_t *t, int tn) {
+  uint64_t carry = 0;
+  int i;
+
+  for (i = 0; i < tn; i++) {
+    carry += (uint64_t)r[i] + t[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+
+  for (; carry != 0 && i < rn; i++) {
+    carry += r[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+}
+
+void mag_mul_school(uint32_t *r, uint32_t *a, int an, uint32_t *b, int bn) {
+  memset(r, 0, (an + bn) * sizeof(uint32_t));
+
+  for (int i = 0; i < an; i++) {
+    uint64_t carry = 0;
+
+    for (int j = 0; j < bn; j++) {
+      carry += (uint64_t)a[i] * b[j] + r[i + j];
+      r[i + j] = (uint32_t)carry;
+      carry >>= 32;
+    }
+
+    r[i + bn] = (uint32_t)carry;
+  }
+}
+
+/* R[0..AN+BN) = A * B.  Karatsuba above KARATSUBA_THRESHOLD limbs:
+ *   (a1 x + a0)(b1 x + b0) = z2 x^2 + z1 x + z0
+ *   z1 = (a0 + a1)(b0 + b1) - z2 - z0
+ */
+void mag_mul(uint32_t *r, uint32_t *a, int an, uint32_t *b, int bn) {
+  if (an < bn) {
+    uint32_t *t = a; a = b; b = t;
+    int tn = an; an = bn; bn = tn;
+  }
+
+  if (bn < KARATSUBA_THRESHOLD) {
+    mag_mul_school(r, a, an, b, bn);
+    return;
+  }
+
+  int h = an / 2;
+
+  if (bn <= h) {
+    // Too lopsided to split B: multiply each half of A by all of B.
+    int tn = an - h + bn;
+    uint32_t *t = malloc(tn * sizeof(uint32_t));
+    assert(t != NULL);
+
+    mag_mul(r, a, h, b, bn);
+    memset(r + h + bn, 0, (an - h) * sizeof(uint32_t));
+    mag_mul(t, a + h, an - h, b, bn);
+    mag_add_into(r + h, an + bn - h, t, mag_trim(t, tn));
+    free(t);
+    return;
+  }
+
+  // z0 goes in the low 2h limbs of R, z2 in the rest.
+  mag_mul(r, a, h, b, h);
+  mag_mul(r + 2 * h, a + h, an - h, b + h, bn - h);
+
+  uint32_t *s1 = malloc((an - h + 1) * sizeof(uint32_t));
+  uint32_t *s2 = malloc(((h > bn - h ? h : bn - h) + 1) * sizeof(uint32_t));
+  assert(s1 != NULL && s2 != NULL);
+
+  int s1n = mag_add(s1, a, h, a + h, an - h);
+  int s2n = mag_add(s2, b, h, b + h, bn - h);
+
+  uint32_t *z1 = malloc((s1n + s2n) * sizeof(uint32_t));
+  assert(z1 != NULL);
+
+  mag_mul(z1, s1, s1n, s2, s2n);
+  int z1n = mag_trim(z1, s1n + s2n);
+  z1n = mag_sub(z1, z1, z1n, r, mag_trim(r, 2 * h));
+  z1n = mag_sub(z1, z1, z1n, r + 2 * h, mag_trim(r + 2 * h, an + bn - 2 * h));
+  mag_add_into(r + h, an + bn - h, z1, z1n);
+
+  free(z1);
+  free(s2);
+  free(s1);
+}
+
+/* Q = U / V for a single limb V; returns the remainder.  Q may alias U. */
+uint32_t mag_div_small(uint32_t *q, uint32_t *u, int n, uint32_t v) {
+  uint64_t rem = 0;
+
+  for (int i = n - 1; i >= 0; i--) {
+    uint64_t cur = (rem << 32) | u[i];
+    q[i] = (uint32_t)(cur / v);
+    rem = cur % v;
+  }
+
+  return (uint32_t)rem;
+}
+
+/* Q[0..M-N] = U / V, Knuth's algorithm D.  Needs M >= N >= 2 and a
+ * trimmed V.
+ */
+void mag_div_knuth(uint32_t *q, uint32_t *u, int m, uint32_t *v, int n) {
+  const uint64_t base = 1ULL << 32;
+  int s = __builtin_clz(v[n - 1]);
+  uint32_t *vn = malloc(n * sizeof(uint32_t));
+  uint32_t *un = malloc((m + 1) * sizeof(uint32_t));
+  assert(vn != NULL && un != NULL);
+
+  // Normalize so the top limb of V has its high bit set.
+  for (int i = n - 1; i > 0; i--)
+    vn[i] = (v[i] << s) | (s ? (uint32_t)((uint64_t)v[i - 1] >> (32 - s)) : 0);
+  vn[0] = v[0] << s;
+
+  un[m] = s ? (uint32_t)((uint64_t)u[m - 1] >> (32 - s)) : 0;
+  for (int i = m - 1; i > 0; i--)
+    un[i] = (u[i] << s) | (s ? (uint32_t)((uint64_t)u[i - 1] >> (32 - s)) : 0);
+  un[0] = u[0] << s;
+
+  for (int j = m - n; j >= 0; j--) {
+    uint64_t num = ((uint64_t)un[j + n] << 32) | un[j + n - 1];
+    uint64_t qhat = num / vn[n - 1];
+    uint64_t rhat = num % vn[n - 1];
+
+    while (qhat >= base ||
+           qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+      qhat--;
+      rhat += vn[n - 1];
+      if (rhat >= base)
+        break;
+    }
+
+    // Multiply and subtract.
+    int64_t k = 0, t;
+    for (int i = 0; i < n; i++) {
+      uint64_t p = qhat * vn[i];
+      t = (int64_t)un[i + j] - k - (int64_t)(p & 0xffffffffUL);
+      un[i + j] = (uint32_t)t;
+      k = (int64_t)(p >> 32) - (t >> 32);
+    }
+    t = (int64_t)un[j + n] - k;
+    un[j + n] = (uint32_t)t;
+
+    q[j] = (uint32_t)qhat;
+
+    // Subtracted too much: add one V back.
+    if (t < 0) {
+      q[j]--;
+      k = 0;
+      for (int i = 0; i < n; i++) {
+        t = (int64_t)un[i + j] + vn[i] + k;
+        un[i + j] = (uint32_t)t;
+        k = t >> 32;
+      }
+      un[j + n] += (uint32_t)k;
+    }
+  }
+
+  free(un);
+  free(vn);
+}
+
+/* A + B, negating B first when SUBTRACT is set. */
+Object *big_add(Object *a, Object *b, int subtract) {
+  struct Big x, y;
+
+  big_load(&x, a);
+  big_load(&y, b);
+  if (subtract)
+    y.neg = !y.neg;
+
+  int rn = (x.len > y.len ? x.len : y.len) + 1;
+  uint32_t *r = malloc(rn * sizeof(uint32_t));
+  assert(r != NULL);
+
+  if (x.neg == y.neg) {
+    mag_add(r, x.d, x.len, y.d, y.len);
+    return big_box(r, rn, x.neg);
+  }
+
+  if (mag_compare(x.d, x.len, y.d, y.len) >= 0) {
+    return big_box(r, mag_sub(r, x.d, x.len, y.d, y.len), x.neg);
+  } else {
+    return big_box(r, mag_sub(r, y.d, y.len, x.d, x.len), y.neg);
+  }
+}
+
+Object *big_mul(Object *a, Object *b) {
+  struct Big x, y;
+
+  big_load(&x, a);
+  big_load(&y, b);
+
+  int rn = x.len + y.len;
+  uint32_t *r = malloc((rn > 0 ? rn : 1) * sizeof(uint32_t));
+  assert(r != NULL);
+
+  mag_mul(r, x.d, x.len, y.d, y.len);
+  return big_box(r, rn, x.neg != y.neg);
+}
+
+/* Quotient truncated toward zero.  Dividing by zero gives 0. */
+Object *big_div(Object *a, Object *b) {
+  struct Big x, y;
+
+  big_load(&x, a);
+  big_load(&y, b);
+
+  if (y.len == 0 || mag_compare(x.d, x.len, y.d, y.len) < 0)
+    return make_fixnum(0);
+
+  int qn = x.len - y.len + 1;
+  uint32_t *q = calloc(x.len, sizeof(uint32_t));
+  assert(q != NULL);
+
+  if (y.len == 1) {
+    mag_div_small(q, x.d, x.len, y.d[0]);
+    qn = x.len;
+  } else {
+    mag_div_knuth(q, x.d, x.len, y.d, y.len);
+  }
+
+  return big_box(q, qn, x.neg != y.neg);
+}
+
+/* The fixnum fast paths work on the tagged words directly, so the
+ * overflow builtins catch exactly the results that leave fixnum range:
+ *   (2x + 1) + 2y     = 2(x + y) + 1
+ *   (2x + 1) - 2y     = 2(x - y) + 1
+ *   2x * y + 1        = 2(xy) + 1
+ */
+Object *number_add(Object *a, Object *b) {
+  long r;
+
+  if (is_fixnum(a) && is_fixnum(b) &&
+      !__builtin_add_overflow((long)a, (long)b - 1, &r))
+    return (Object *)r;
+
+  return big_add(a, b, 0);
+}
+
+Object *number_sub(Object *a, Object *b) {
+  long r;
+
+  if (is_fixnum(a) && is_fixnum(b) &&
+      !__builtin_sub_overflow((long)a, (long)b - 1, &r))
+    return (Object *)r;
+
+  return big_add(a, b, 1);
+}
+
+Object *number_mul(Object *a, Object *b) {
+  long r;
+
+  if (is_fixnum(a) && is_fixnum(b) &&
+      !__builtin_mul_overflow((long)a - 1, fixnum_value(b), &r))
+    return (Object *)(r + 1);
+
+  return big_mul(a, b);
+}
+
+Object *number_div(Object *a, Object *b) {
+  if (is_fixnum(a) && is_fixnum(b)) {
+    if (fixnum_value(b) == 0)
+      return make_fixnum(0);
+
+    // Only FIXNUM_MIN / -1 leaves the range, and make_fixnum handles it.
+    return make_fixnum(fixnum_value(a) / fixnum_value(b));
+  }
+
+  return big_div(a, b);
+}
+
+int number_compare(Object *a, Object *b) {
+  if (is_fixnum(a) && is_fixnum(b)) {
+    long x = fixnum_value(a), y = fixnum_value(b);
+    return x < y ? -1 : x > y;
+  }
+
+  struct Big x, y;
+
+  big_load(&x, a);
+  big_load(&y, b);
+
+  if (x.neg != y.neg)
+    return x.neg ? -1 : 1;
+
+  int result = mag_compare(x.d, x.len, y.d, y.len);
+  return x.neg ? -result : result;
+}
+
+/* Returns NULL unless TEXT is an optional sign followed by digits. */
+Object *parse_integer(char *text) {
+  char *p = text;
+  int neg = 0;
+
+  if (*p == '-' || *p == '+') {
+    neg = *p == '-';
+    p++;
+  }
+
+  int digits = strlen(p);
+
+  if (digits == 0 || (int)strspn(p, "0123456789") != digits)
+    return NULL;
+
+  // 18 digits always fit in a long; make_fixnum promotes if needed.
+  if (digits <= 18) {
+    long value = strtol(p, NULL, 10);
+    return make_fixnum(neg ? -value : value);
+  }
+
+  int cap = digits / 9 + 2;
+  uint32_t *d = calloc(cap, sizeof(uint32_t));
+  int len = 0;
+  assert(d != NULL);
+
+  // Fold in nine digits at a time: d = d * 10^k + chunk.
+  for (int i = 0, k = digits % 9 ? digits % 9 : 9; i < digits; i += k, k = 9) {
+    uint32_t chunk = 0, scale = 1;
+
+    for (int j = 0; j < k; j++) {
+      chunk = chunk * 10 + (p[i + j] - '0');
+      scale *= 10;
+    }
+
+    uint64_t carry = chunk;
+    for (int j = 0; j < len; j++) {
+      carry += (uint64_t)d[j] * scale;
+      d[j] = (uint32_t)carry;
+      carry >>= 32;
+    }
+    if (carry != 0)
+      d[len++] = (uint32_t)carry;
+  }
+
+  return big_box(d, cap, neg);
+}
+
+/* Returns a malloc'd decimal string. */
+char *integer_to_string(Object *n) {
+  char *str = NULL;
+
+  if (is_fixnum(n)) {
+    asprintf(&str, "%ld", fixnum_value(n));
+    return str;
+  }
+
+  // Peel off nine decimal digits at a time from a scratch copy.
+  int len = n->big.len;
+  uint32_t *t = malloc(len * sizeof(uint32_t));
+  uint32_t *chunks = malloc((len * 2 + 1) * sizeof(uint32_t));
+  int nchunks = 0;
+  assert(t != NULL && chunks != NULL);
+
+  memcpy(t, n->big.digits, len * sizeof(uint32_t));
+  while (len > 0) {
+    chunks[nchunks++] = mag_div_small(t, t, len, 1000000000);
+    len = mag_trim(t, len);
+  }
+
+  str = malloc(nchunks * 9 + 2);
+  assert(str != NULL);
+
+  char *p = str;
+  if (n->big.neg)
+    *p++ = '-';
+  p += sprintf(p, "%u", chunks[nchunks - 1]);
+  for (int i = nchunks - 2; i >= 0; i--)
+    p += sprintf(p, "%09u", chunks[i]);
+
+  free(chunks);
+  free(t);
+  return str;
+}
@@ -0,0 +1,25 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Arbitrary precision integers.
+ *
+ */
+
+/* Above this many 32 bit limbs, multiply with Karatsuba. */
+#define KARATSUBA_THRESHOLD 32
+
+Object *bignum_from_long(long n);
+int bignum_to_long(Object *n, long *out);
+Object *bignum_copy(Object *n);
+void bignum_free(Object *n);
+unsigned long bignum_hash(Object *n);
+
+Object *parse_integer(char *text);
+char *integer_to_string(Object *n);
+
+Object *number_add(Object *a, Object *b);
+Object *number_sub(Object *a, Object *b);
+Object *number_mul(Object *a, Object *b);
+Object *number_div(Object *a, Object *b);
+int number_compare(Object *a, Object *b);
@@ -0,0 +1,146 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Embedding API.
+ *
+ * Evaluation runs under a setjmp() that error() jumps back to.  The
+ * frames it unwinds never unpin their variables, so the pins made
+ * since the call began are dropped here, and the profiler's call stack
+ * is cut back the same way.  Anything those frames had malloc'd for
+ * themselves is lost, but every heap object is reclaimed by the next
+ * collection.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "bignum.h"
+#include "profile.h"
+#include "embed.h"
+
+void interp_define(struct Interp *in, char *name, Object *value) {
+  interp = in;
+
+  Object *var = NULL;
+  pin_variable((void **)&value);
+  pin_variable((void **)&var);
+
+  var = intern_symbol(name);
+  extend_top(var, value);
+
+  unpin_variable((void **)&var);
+  unpin_variable((void **)&value);
+}
+
+void interp_define_primitive(struct Interp *in, char *name, primitive_fn *fn) {
+  interp = in;
+  interp_define(in, name, make_primitive(fn));
+}
+
+/* Evaluate each form read from FP.  Returns 0 with the last value in
+ * *RESULT, or -1 if evaluation signalled an error.
+ */
+int interp_eval_stream(struct Interp *in, FILE *fp, Object **result) {
+  jmp_buf handler;
+  jmp_buf *outer = in->error_jump;
+  int pins, depth, jit_off;
+  Object *form = NULL;
+
+  interp = in;
+  pins = pinned_variable_count;
+  depth = profile_depth;
+  jit_off = in->jit_off;
+
+  if (setjmp(handler) != 0) {
+    unpin_to(pins);
+    profile_depth = depth;
+    in->jit_off = jit_off;
+    in->error_jump = outer;
+    in->result = s_nil;
+    if (result != NULL)
+      *result = s_nil;
+    return -1;
+  }
+
+  in->error_jump = &handler;
+  in->error_message[0] = '\0';
+  in->result = s_nil;
+
+  pin_variable((void **)&form);
+  while ((form = read_lisp(fp)) != NULL)
+    in->result = eval_top(form);
+  unpin_variable((void **)&form);
+
+  in->error_jump = outer;
+  if (result != NULL)
+    *result = in->result;
+  return 0;
+}
+
+int interp_eval_string(struct Interp *in, char *text, size_t len, Object **result) {
+  interp = in;
+
+  if (len == 0) {
+    in->result = s_nil;
+    if (result != NULL)
+      *result = s_nil;
+    return 0;
+  }
+
+  FILE *fp = fmemopen(text, len, "r");
+
+  if (fp == NULL) {
+    snprintf(in->error_message, sizeof(in->error_message), "Cannot read string");
+    return -1;
+  }
+
+  int status = interp_eval_stream(in, fp, result);
+
+  fclose(fp);
+  return status;
+}
+
+int interp_eval_file(struct Interp *in, char *path, Object **result) {
+  FILE *fp = fopen(path, "r");
+
+  if (fp == NULL) {
+    snprintf(in->error_message, sizeof(in->error_message), "Cannot open %s", path);
+    return -1;
+  }
+
+  int status = interp_eval_stream(in, fp, result);
+
+  fclose(fp);
+  return status;
+}
+
+char *interp_error(struct Interp *in) {
+  return in->error_message;
+}
+
+/* The value of an integer in *OUT; returns 0 if OBJ is not one or does
+ * not fit in a long.
+ */
+int value_to_long(Object *obj, long *out) {
+  if (is_fixnum(obj)) {
+    *out = fixnum_value(obj);
+    return 1;
+  }
+
+  if (type_of(obj) == BIGNUM)
+    return bignum_to_long(obj, out);
+
+  return 0;
+}
+
+/* The text of a string or the name of a symbol, owned by the object;
+ * NULL for anything else.
+ */
+char *value_to_string(Object *obj) {
+  if (is_string(obj))
+    return obj->str.text;
+  if (is_symbol(obj))
+    return obj->symbol.name;
+  return NULL;
+}
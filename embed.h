@@ -0,0 +1,30 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Embedding API.
+ *
+ */
+
+/* Include after jcm-lisp.h and link with libjcmlisp (make lib).  A
+ * host creates an interpreter with interp_new(heap_size), defines its
+ * own primitives, evaluates text, and releases it with interp_free().
+ *
+ * Each call below makes IN the current interpreter of the calling
+ * thread, so Lisp objects can then be built with make_fixnum(),
+ * make_string() and cons().  Errors, including those raised by the
+ * host's primitives with error(), come back as -1 with the message in
+ * interp_error() instead of ending the process.  Values returned stay
+ * valid until the next evaluation in the same interpreter.
+ */
+
+void interp_define(struct Interp *in, char *name, Object *value);
+void interp_define_primitive(struct Interp *in, char *name, primitive_fn *fn);
+
+int interp_eval_stream(struct Interp *in, FILE *fp, Object **result);
+int interp_eval_string(struct Interp *in, char *text, size_t len, Object **result);
+int interp_eval_file(struct Interp *in, char *path, Object **result);
+char *interp_error(struct Interp *in);
+
+int value_to_long(Object *obj, long *out);
+char *value_to_string(Object *obj);
@@ -0,0 +1,253 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Structural equality and hashing.
+ *
+ * (equal a b) is true if A and B are the same object, numbers with
+ * the same value, strings with the same contents, or cells whose cars
+ * and cdrs are equal.  Anything else, vectors included, is compared
+ * by identity.  (sxhash obj) is a non-negative fixnum that is the same
+ * for equal objects.  Equal hash tables use both (see hash.c).
+ *
+ * Both walk cells with an explicit stack rather than C recursion,
+ * following cars and saving cdrs, so a long list needs one entry and
+ * only nesting in the car grows the stack.  No Lisp code runs and
+ * nothing is allocated from the heap, so the collector cannot move or
+ * free anything underneath them.
+ *
+ * Circular structure: equal_objects() treats a pair of cells met again
+ * as equal, since any difference below it is found from the first
+ * visit.  A cycle through cdrs alone comes back round to a pair it
+ * saved as an anchor, moved on at each power of two (Brent's method);
+ * one through a car deepens the stack, and beyond EQUAL_CYCLE_CHECK
+ * saved cdrs every pair is recorded from then on.  So comparing
+ * circular lists terminates, and two that unroll to the same infinite
+ * list are equal.  Acyclic data shallower than that costs nothing
+ * extra.
+ * sxhash_object() stops after SXHASH_MAX_CELLS cells, which keeps equal
+ * objects hashing alike because both unroll the same way.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "hash.h"
+#include "bignum.h"
+#include "equal.h"
+
+/* A stack of objects, in the caller's frame until it outgrows it. */
+struct WorkStack {
+  Object **items;
+  int len;
+  int capacity;
+  Object *inline_items[EQUAL_STACK_INLINE];
+};
+
+void work_init(struct WorkStack *stack) {
+  stack->items = stack->inline_items;
+  stack->len = 0;
+  stack->capacity = EQUAL_STACK_INLINE;
+}
+
+void work_push(struct WorkStack *stack, Object *obj) {
+  if (stack->len == stack->capacity) {
+    int capacity = stack->capacity * 2;
+
+    if (stack->items == stack->inline_items) {
+      stack->items = malloc(capacity * sizeof(Object *));
+      assert(stack->items != NULL);
+      memcpy(stack->items, stack->inline_items, stack->len * sizeof(Object *));
+    } else {
+      stack->items = realloc(stack->items, capacity * sizeof(Object *));
+      assert(stack->items != NULL);
+    }
+    stack->capacity = capacity;
+  }
+
+  stack->items[stack->len++] = obj;
+}
+
+Object *work_pop(struct WorkStack *stack) {
+  return stack->items[--stack->len];
+}
+
+void work_free(struct WorkStack *stack) {
+  if (stack->items != stack->inline_items)
+    free(stack->items);
+}
+
+/* A set of (a, b) pairs of cells, open addressed like hash tables. */
+struct PairSet {
+  Object **pairs;
+  unsigned long capacity;
+  unsigned long count;
+};
+
+unsigned long pair_hash(Object *a, Object *b) {
+  return hash_pointer(a) ^ (hash_pointer(b) * 0x9e3779b97f4a7c15UL);
+}
+
+void pair_set_insert(struct PairSet *set, Object *a, Object *b) {
+  unsigned long mask = set->capacity - 1;
+  unsigned long i = pair_hash(a, b) & mask;
+
+  while (set->pairs[2 * i] != NULL)
+    i = (i + 1) & mask;
+
+  set->pairs[2 * i] = a;
+  set->pairs[2 * i + 1] = b;
+  set->count++;
+}
+
+/* Add (A, B) to SET; returns 1 if it was there already. */
+int pair_set_add(struct PairSet *set, Object *a, Object *b) {
+  if (2 * (set->count + 1) > set->capacity) {
+    Object **old = set->pairs;
+    unsigned long old_capacity = set->capacity;
+
+    set->capacity = old_capacity == 0 ? 1024 : 2 * old_capacity;
+    set->pairs = calloc(2 * set->capacity, sizeof(Object *));
+    assert(set->pairs != NULL);
+    set->count = 0;
+
+    for (unsigned long i = 0; i < old_capacity; i++) {
+      if (old[2 * i] != NULL)
+        pair_set_insert(set, old[2 * i], old[2 * i + 1]);
+    }
+    free(old);
+  }
+
+  unsigned long mask = set->capacity - 1;
+
+  for (unsigned long i = pair_hash(a, b) & mask; set->pairs[2 * i] != NULL; i = (i + 1) & mask) {
+    if (set->pairs[2 * i] == a && set->pairs[2 * i + 1] == b)
+      return 1;
+  }
+
+  pair_set_insert(set, a, b);
+  return 0;
+}
+
+int equal_atoms(Object *a, Object *b) {
+  if (a == b)
+    return 1;
+
+  // Integers in fixnum range are always fixnums, so a fixnum never
+  // equals a bignum.
+  if (type_of(a) == BIGNUM && type_of(b) == BIGNUM)
+    return number_compare(a, b) == 0;
+  if (is_string(a) && is_string(b))
+    return a->str.len == b->str.len &&
+      memcmp(a->str.text, b->str.text, a->str.len) == 0;
+
+  return 0;
+}
+
+int equal_objects(Object *a, Object *b) {
+  if (a == b)
+    return 1;
+  if (!is_cell(a) || !is_cell(b))
+    return equal_atoms(a, b);
+
+  struct WorkStack stack;
+  struct PairSet seen = { NULL, 0, 0 };
+  Object *anchor_a = NULL;
+  Object *anchor_b = NULL;
+  long cells = 0;
+  long next_anchor = 1;
+  int result = 1;
+
+  work_init(&stack);
+
+  for (;;) {
+    while (a != b && is_cell(a) && is_cell(b)) {
+      // A pair met before: a cycle through cdrs returns to the anchor,
+      // one through a car keeps deepening the stack.
+      if (a == anchor_a && b == anchor_b)
+        break;
+      if (++cells == next_anchor) {
+        anchor_a = a;
+        anchor_b = b;
+        next_anchor *= 2;
+      }
+      if ((seen.pairs != NULL || stack.len > 2 * EQUAL_CYCLE_CHECK) &&
+          pair_set_add(&seen, a, b))
+        break;
+
+      work_push(&stack, a->cell.cdr);
+      work_push(&stack, b->cell.cdr);
+      a = a->cell.car;
+      b = b->cell.car;
+    }
+
+    // Two cells here are a pair already under comparison.
+    if (!(is_cell(a) && is_cell(b)) && !equal_atoms(a, b)) {
+      result = 0;
+      break;
+    }
+
+    if (stack.len == 0)
+      break;
+    b = work_pop(&stack);
+    a = work_pop(&stack);
+  }
+
+  work_free(&stack);
+  free(seen.pairs);
+  return result;
+}
+
+/* The hash of anything but a cell: by contents for strings and
+ * bignums, otherwise by identity.
+ */
+unsigned long sxhash_atom(Object *obj) {
+  if (is_string(obj))
+    return hash_bytes(obj->str.text, obj->str.len);
+  if (type_of(obj) == BIGNUM)
+    return bignum_hash(obj);
+
+  return hash_pointer(obj);
+}
+
+unsigned long sxhash_object(Object *obj) {
+  if (!is_cell(obj))
+    return sxhash_atom(obj);
+
+  struct WorkStack stack;
+  unsigned long h = 0xcbf29ce484222325UL;
+  int cells = 0;
+
+  work_init(&stack);
+
+  for (;;) {
+    if (is_cell(obj)) {
+      if (++cells > SXHASH_MAX_CELLS)
+        break;
+
+      // Mix in the shape as well, so (a b) and ((a) b) differ.
+      h = (h ^ CELL) * 0x100000001b3UL;
+      work_push(&stack, obj->cell.cdr);
+      obj = obj->cell.car;
+      continue;
+    }
+
+    h = (h ^ sxhash_atom(obj)) * 0x100000001b3UL;
+
+    if (stack.len == 0)
+      break;
+    obj = work_pop(&stack);
+  }
+
+  work_free(&stack);
+  return h;
+}
+
+/* (equal a b) */
+Object *primitive_equal(Object *args) {
+  return equal_objects(car(args), cadr(args)) ? s_t : s_nil;
+}
+
+/* (sxhash obj) */
+Object *primitive_sxhash(Object *args) {
+  return make_fixnum((long)(sxhash_object(car(args)) & FIXNUM_MAX));
+}
@@ -0,0 +1,26 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Structural equality and hashing.
+ *
+ */
+
+/* Depth of nesting in the car at which equal_objects() starts
+ * recording the pairs of cells it compares, to notice cycles.
+ */
+#define EQUAL_CYCLE_CHECK  4096
+
+/* Cells sxhash_object() hashes; the rest of a larger object is ignored. */
+#define SXHASH_MAX_CELLS   4096
+
+/* Entries of the explicit stacks kept in the C frame before they move
+ * to the heap.
+ */
+#define EQUAL_STACK_INLINE 64
+
+int equal_objects(Object *a, Object *b);
+unsigned long sxhash_object(Object *obj);
+
+Object *primitive_equal(Object *args);
+Object *primitive_sxhash(Object *args);
@@ -7,11 +7,15 @@
  *
  */
 
+#include <sys/resource.h>
+
 #include "jcm-lisp.h"
 #include "gc.h"
+#include "hash.h"
+#include "bignum.h"
+#include "jit.h"
 
 #ifdef GC_PIN
-int pinned_variable_count = 0;
 
 void print_pins() {
   printf("\nPinned variables:\n");
@@ -98,14 +102,114 @@ void unpin_variable(void *variable) { // void
 }
 #endif // GC_PIN
 
+/* Drop the pins made since there were COUNT, newest first.  For error
+ * recovery: the frames that would have unpinned them are gone.
+ */
+void unpin_to(int count) {
+#ifdef GC_PIN
+  while (pinned_variable_count > count) {
+    struct PinnedVariable *next = pinned_variables->next;
+
+    free(pinned_variables);
+    pinned_variables = next; pinned_variable_count--;
+  }
+#endif // GC_PIN
+}
+
+double now_seconds() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Peak resident set of the process in kilobytes. */
+long max_rss_kb() {
+  struct rusage usage;
+
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;  /* bytes on macOS */
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+/* One line of key=value pairs, for bench/run.sh to collect. */
+void print_gc_stats() {
+  if (interp == NULL)
+    return;
+
+  fflush(stdout);
+  fprintf(stderr, "stats wall_ms=%.3f allocs=%ld gc_count=%ld gc_ms=%.3f max_rss_kb=%ld max_live=%ld\n",
+          (now_seconds() - gc_stats.start_seconds) * 1000,
+          gc_stats.allocs, gc_stats.collections, gc_stats.gc_seconds * 1000,
+          max_rss_kb(), gc_stats.max_live);
+}
+
+/* All objects live in one block, handed out through free_list. */
+void heap_init(int size) {
+  heap_size = size;
+  interp->heap = calloc(size, sizeof(struct Object));
+  free_list = calloc(size, sizeof(void *));
+  active_list = calloc(size, sizeof(void *));
+  assert(interp->heap != NULL && free_list != NULL && active_list != NULL);
+  interp->heap_end = interp->heap + size;
+
+  for (int i = 0; i < size; i++) {
+    Object *obj = &interp->heap[i];
+    obj->id = i + 1;
+    obj->type = UNKNOWN;
+    free_list[i] = obj;
+  }
+
+  next_free_slot = 0;
+  current_mark = 1;
+}
+
+/* Workers run by parallel-map read their parent's objects but never
+ * store into them, since the parent's collector cannot see a worker's
+ * heap.
+ */
+void check_writable(Object *obj) {
+  if (!is_immediate(obj) && !in_heap(obj))
+    error("Cannot modify an object shared by parallel-map");
+}
+
+void heap_free() {
+  for (int i = 0; i < heap_size; i++) {
+    if (active_list[i] != NULL)
+      free_payload(active_list[i]);
+  }
+
+  while (pinned_variables != NULL) {
+    struct PinnedVariable *next = pinned_variables->next;
+    free(pinned_variables);
+    pinned_variables = next;
+  }
+
+  free(active_list);
+  free(free_list);
+  free(interp->heap);
+  active_list = free_list = NULL;
+  interp->heap = interp->heap_end = NULL;
+  heap_size = 0;
+}
+
 #ifdef GC_ENABLED
+
 void mark(Object *obj) {
+ tail:
   if (obj == NULL) {
 #ifdef GC_DEBUG
     printf("\nNothing to mark: NULL");
 #endif // GC_DEBUG
     return;
   }
+  // Another interpreter's object: a parallel-map worker's view of its
+  // parent, which the parent keeps alive.
+  if (is_immediate(obj) || !in_heap(obj))
+    return;
 #ifdef GC_DEBUG_XX
   void *temp = obj; printf("\nMarking %p\n", temp);
 #endif // GC_DEBUG_XX
@@ -127,7 +231,7 @@ void mark(Object *obj) {
 #endif // GC_DEBUG
 
   switch (obj->type) {
-    case FIXNUM:
+    case BIGNUM:
     case STRING:
     case SYMBOL:
     case PRIMITIVE:
@@ -137,6 +241,8 @@ void mark(Object *obj) {
 #endif // GC_DEBUG_XX
       break;
     case CELL:
+      if (obj->cell.cache != NULL)
+        mark(obj->cell.cache);
 #ifdef GC_DEBUG_XX
       printf("\nMark cell car %p -> %p", obj, obj->cell.car);
 #endif // GC_DEBUG_XX
@@ -147,11 +253,9 @@ void mark(Object *obj) {
 #ifdef GC_DEBUG_XX
       printf("\nMark cell cdr %p -> %p", obj, obj->cell.cdr);
 #endif // GC_DEBUG_XX
-      mark(obj->cell.cdr);
-#ifdef GC_DEBUG_XX
-      printf("\nMark cell cdr %p <-", obj);
-#endif // GC_DEBUG_XX
-      break;
+      // Loop on the cdr so long lists do not recurse once per cell.
+      obj = obj->cell.cdr;
+      goto tail;
     case PROC:
 #ifdef GC_DEBUG_XX
       printf("\nMark proc ->");
@@ -172,6 +276,15 @@ void mark(Object *obj) {
       printf("\nMark proc <-");
 #endif // GC_DEBUG_XX
       break;
+    case VECTOR:
+      for (int i = 0; i < obj->vec.len; i++)
+        mark(obj->vec.items[i]);
+      break;
+    case ARRAY:
+      break;
+    case HASHTABLE:
+      hash_mark(obj);
+      break;
     default:
       printf("\nMark unknown object: %d\n", obj->type);
       break;
@@ -179,7 +292,7 @@ void mark(Object *obj) {
 }
 
 int is_active(void *needle) {
-  for (int i = 0; i <= MAX_ALLOC_SIZE; i++) {
+  for (int i = 0; i < heap_size; i++) {
     if (active_list[i] == needle)
       return 1;
   }
@@ -187,11 +300,45 @@ int is_active(void *needle) {
   return 0;
 }
 
+/* Free any additional allocated memory. */
+void free_payload(Object *obj) {
+  switch (obj->type) {
+    case STRING:
+      memset(obj->str.text, 0, obj->str.len);
+      free(obj->str.text);
+      break;
+    case SYMBOL:
+      memset(obj->symbol.name, 0, strlen(obj->symbol.name));
+      free(obj->symbol.name);
+      break;
+    case VECTOR:
+      free(obj->vec.items);
+      obj->vec.items = NULL;
+      obj->vec.len = 0;
+      break;
+    case ARRAY:
+      free(obj->arr.data);
+      obj->arr.data = NULL;
+      break;
+    case HASHTABLE:
+      hash_free(obj);
+      break;
+    case BIGNUM:
+      bignum_free(obj);
+      break;
+    case PROC:
+      jit_free(obj);
+      break;
+    default:
+      break;
+  }
+}
+
 void sweep() {
   int counted = 0, kept = 0, swept = 0;
   int cells = 0;
 
-  for (int i = 0; i < MAX_ALLOC_SIZE; i++) {
+  for (int i = 0; i < heap_size; i++) {
     Object *obj = active_list[i];
 
     if (obj == NULL)
@@ -207,37 +354,28 @@ void sweep() {
       print(obj);
 #endif // GC_DEBUG
 
-      // Free any additional allocated memory.
-      switch (obj->type) {
-        case STRING:
-          memset(obj->str.text, 0, strlen(obj->str.text));
-          free(obj->str.text);
-          printf("\n");
-          break;
-        case SYMBOL:
-          memset(obj->symbol.name, 0, strlen(obj->symbol.name));
-          free(obj->symbol.name);
-          printf("\n");
-          break;
-        case CELL:
-          cells++;
-          break;
-        default:
-          printf("\n");
-          break;
-      }
+      if (obj->type == CELL)
+        cells++;
+      free_payload(obj);
+#ifdef GC_DEBUG
+      if (obj->type != CELL)
+        printf("\n");
+#endif // GC_DEBUG
 
       free_list[i] = obj;
       active_list[i] = NULL;
       swept++;
 
+      if (i < next_free_slot)
+        next_free_slot = i;
+
     } else {
 #ifdef GC_DEBUG_XX
       printf("\nDo NOT sweep: %p id: %d mark: %d ", obj, obj->id, obj->mark);
 
       print(obj);
       switch (obj->type) {
-        case FIXNUM:
+        case BIGNUM:
           printf("\n");
           break;
         case STRING:
@@ -264,6 +402,9 @@ void sweep() {
 
     counted++;
   }
+
+  if (kept > gc_stats.max_live)
+    gc_stats.max_live = kept;
 #ifdef GC_DEBUG
   printf("\nDone sweep.  kept: %d swept: %d counted: %d\n\n", kept, swept, counted);
   printf("%d are cells\n", cells);
@@ -273,7 +414,7 @@ void sweep() {
 int check_active() {
   int counted = 0;
 
-  for (int i = 0; i < MAX_ALLOC_SIZE; i++) {
+  for (int i = 0; i < heap_size; i++) {
     if (active_list[i] != NULL)
       counted++;
   }
@@ -287,7 +428,7 @@ int check_active() {
 int check_free() {
   int counted = 0;
 
-  for (int i = 1; i <= MAX_ALLOC_SIZE; i++) {
+  for (int i = 0; i < heap_size; i++) {
     if (free_list[i] != NULL)
       counted++;
   }
@@ -302,27 +443,38 @@ void check_mem() {
   int active = check_active();
   int free = check_free();
   int total = active + free;
+#ifdef GC_DEBUG
   printf("\nDone check_mem: %d total\n", total);
-  if (total != MAX_ALLOC_SIZE) {
-    printf("Missing %d objects", MAX_ALLOC_SIZE - total);
+#endif // GC_DEBUG
+  if (total != heap_size) {
+    printf("Missing %d objects", heap_size - total);
     error("check_mem fail!");
   }
 }
 
 void gc() {
+  double start = now_seconds();
 
+#ifdef GC_DEBUG
   printf("\nGC v----------------------------------------v\n");
+#endif // GC_DEBUG
   check_mem();
 
 #ifdef GC_MARK
+#ifdef GC_DEBUG
   printf("\n-------- Mark symbols:");
+#endif // GC_DEBUG
   mark(symbols);
 
+#ifdef GC_DEBUG
   printf("\n-------- Mark top_env:");
+#endif // GC_DEBUG
   mark(top_env);
 
 #ifdef GC_PIN
+#ifdef GC_DEBUG
   printf("\n-------- Mark pins:\n");
+#endif // GC_DEBUG
   struct PinnedVariable **v = NULL;
   v = &pinned_variables;
 
@@ -332,40 +484,57 @@ void gc() {
       continue;
     }
 
+#ifdef GC_DEBUG
     printf("Pointer to pointer to variable: %p\n", v);
     printf("Pointer to variable: %p\n", *v);
     printf("Pointer to pointer to object: %p\n", (*v)->variable);
     printf("Pointer to object: %p\n", *(*v)->variable);
+#endif // GC_DEBUG
 
     void *tempObj = (void *)(*(*v)->variable);
     if (tempObj != NULL) {
+#ifdef GC_DEBUG
       print(tempObj);
+#endif // GC_DEBUG
       mark(tempObj);
+#ifdef GC_DEBUG
       print(*(*v)->variable);
       printf("\nMarked pinned var\n");
+#endif // GC_DEBUG
     }
   }
 #endif // GC_PIN
 #endif // GC_MARK
 
 #ifdef GC_SWEEP
+#ifdef GC_DEBUG
   printf("\n-------- Sweep\n");
+#endif // GC_DEBUG
   sweep();
   check_mem();
 #endif // GC_SWEEP
 
+#ifdef GC_DEBUG
   printf("\nGC ^----------------------------------------^\n");
+#endif // GC_DEBUG
+
+  gc_stats.collections++;
+  gc_stats.gc_seconds += now_seconds() - start;
 }
 
+/* Slots below next_free_slot are all in use, so each allocation
+ * resumes the scan where the last one stopped instead of at 0.
+ */
 void *find_next_free() {
   void *obj = NULL;
 
-  for (int i = 0; i < MAX_ALLOC_SIZE; i++) {
-    obj = free_list[i];
+  for (; next_free_slot < heap_size; next_free_slot++) {
+    obj = free_list[next_free_slot];
 
     if (obj != NULL) {
-      free_list[i] = NULL;
-      active_list[i] = obj;
+      free_list[next_free_slot] = NULL;
+      active_list[next_free_slot] = obj;
+      next_free_slot++;
       break;
     }
   }
@@ -384,6 +553,8 @@ void *alloc_Object() {
   }
 
   if (obj == NULL) {
+    if (interp->error_jump != NULL)
+      error("Out of memory");
     printf("Out of memory\n");
     exit(-1);
   }
@@ -392,6 +563,7 @@ void *alloc_Object() {
   printf("Allocated %d ", obj->id);
 #endif
 
+  gc_stats.allocs++;
   return obj;
 }
 #endif // GC_ENABLED
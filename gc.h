@@ -19,23 +19,41 @@
 #include <sys/errno.h>
 
 #define MAX_BUFFER_SIZE 100
+
+/* stdio buffer for files streamed with for-each-form. */
+#define STREAM_BUFFER_SIZE  (1 << 16)
+
+/* Default heap size in objects; override with -DMAX_ALLOC_SIZE=n.  The
+ * file tests keep every definition they make, so they get more room.
+ */
+#ifndef MAX_ALLOC_SIZE
+#ifdef FILE_TEST
+#define MAX_ALLOC_SIZE  2048
+#else
 #define MAX_ALLOC_SIZE  1024
+#endif
+#endif
 
 #define GC_ENABLED
 #define GC_MARK
 #define GC_SWEEP
 #define GC_PIN
 
-#define GC_DEBUG
+/* The GC trace is on with -DGC_DEBUG (make CONFIG=debug). */
 //#define GC_DEBUG_X
 //#define GC_DEBUG_XX
 //#define GC_PIN_DEBUG
 //#define GC_PIN_DEBUG_X
 
-void *free_list[MAX_ALLOC_SIZE];
-void *active_list[MAX_ALLOC_SIZE];
-
-int current_mark;
+/* Heap state belongs to the current interpreter; see struct Interp. */
+#define heap_size              (interp->heap_size)
+#define free_list              (interp->free_list)
+#define active_list            (interp->active_list)
+#define next_free_slot         (interp->next_free_slot)
+#define current_mark           (interp->current_mark)
+#define pinned_variables       (interp->pinned_variables)
+#define pinned_variable_count  (interp->pinned_variable_count)
+#define gc_stats               (interp->gc_stats)
 
 #ifdef GC_PIN
 struct PinnedVariable {
@@ -44,15 +62,29 @@ struct PinnedVariable {
   int inUse;
 };
 
-struct PinnedVariable *pinned_variables;
-
 #endif //GC_PIN
 
+double now_seconds();
+long max_rss_kb();
+void print_gc_stats();
+
 void pin_variable(void **obj);
 void unpin_variable(void **obj);
+void unpin_to(int count);
+
+/* Whether OBJ is one of IN's heap objects. */
+#define in_heap_of(in, obj)  ((Object *)(obj) >= (in)->heap && (Object *)(obj) < (in)->heap_end)
+#define in_heap(obj)         in_heap_of(interp, obj)
+
+void check_writable(Object *obj);
+
+void free_payload(Object *obj);
+void heap_init(int size);
+void heap_free();
 
 #ifdef GC_ENABLED
 void *alloc_Object();
+void mark(Object *obj);
 void gc();
 void error(char *msg);
 #endif // GC_ENABLED
@@ -0,0 +1,276 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Hash tables.
+ *
+ * Open addressing with linear probing in one malloc'd block of
+ * entries.  A NULL key marks an empty slot and hash_tombstone a
+ * removed one.  Tables made with 'eq compare keys by identity, which
+ * suits interned symbols and fixnums.  The default 'equal table
+ * compares keys with equal_objects() and hashes them with
+ * sxhash_object() (see equal.c).
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "hash.h"
+#include "alloc.h"
+#include "equal.h"
+
+#define HASH_MIN_CAPACITY 8
+
+static Object hash_tombstone;
+#define TOMBSTONE (&hash_tombstone)
+
+unsigned long hash_pointer(void *ptr) {
+  unsigned long h = (unsigned long)ptr;
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdUL;
+  h ^= h >> 33;
+  return h;
+}
+
+/* FNV-1a */
+unsigned long hash_bytes(char *bytes, int len) {
+  unsigned long h = 0xcbf29ce484222325UL;
+
+  for (int i = 0; i < len; i++) {
+    h ^= (unsigned char)bytes[i];
+    h *= 0x100000001b3UL;
+  }
+
+  return h;
+}
+
+/* Fixnums are immediate, so identity already compares them by value. */
+unsigned long hash_key(int test, Object *key) {
+  return test == HASH_EQUAL ? sxhash_object(key) : hash_pointer(key);
+}
+
+int hash_key_equal(int test, Object *a, Object *b) {
+  return a == b || (test == HASH_EQUAL && equal_objects(a, b));
+}
+
+/* Slot holding KEY, or the empty slot where it would go. */
+struct HashEntry *hash_find(Object *table, Object *key) {
+  struct Hash *h = &table->hash;
+  unsigned long mask = h->capacity - 1;
+  unsigned long i = hash_key(h->test, key) & mask;
+  struct HashEntry *tombstone = NULL;
+
+  for (;;) {
+    struct HashEntry *entry = &h->entries[i];
+
+    if (entry->key == NULL)
+      return tombstone != NULL ? tombstone : entry;
+
+    if (entry->key == TOMBSTONE) {
+      if (tombstone == NULL)
+        tombstone = entry;
+    } else if (hash_key_equal(h->test, entry->key, key)) {
+      return entry;
+    }
+
+    i = (i + 1) & mask;
+  }
+}
+
+void hash_resize(Object *table, int capacity) {
+  struct Hash *h = &table->hash;
+  struct HashEntry *old = h->entries;
+  int old_capacity = h->capacity;
+
+  h->entries = calloc(capacity, sizeof(struct HashEntry));
+  assert(h->entries != NULL);
+  h->capacity = capacity;
+  h->used = h->count;
+
+  for (int i = 0; i < old_capacity; i++) {
+    if (old[i].key != NULL && old[i].key != TOMBSTONE)
+      *hash_find(table, old[i].key) = old[i];
+  }
+
+  free(old);
+}
+
+Object *make_hash_table(int test) {
+  Object *obj = NULL;
+
+  pin_variable((void **)&obj);
+  obj = new_Object(HASHTABLE);
+  obj->hash.test = test;
+  obj->hash.count = 0;
+  obj->hash.used = 0;
+  obj->hash.capacity = HASH_MIN_CAPACITY;
+  obj->hash.entries = calloc(HASH_MIN_CAPACITY, sizeof(struct HashEntry));
+  assert(obj->hash.entries != NULL);
+  alloc_track_bytes(HASH_MIN_CAPACITY * sizeof(struct HashEntry));
+  unpin_variable((void **)&obj);
+  return obj;
+}
+
+Object *hash_get(Object *table, Object *key) {
+  struct HashEntry *entry = hash_find(table, key);
+
+  if (entry->key == NULL || entry->key == TOMBSTONE)
+    return NULL;
+
+  return entry->value;
+}
+
+void hash_put(Object *table, Object *key, Object *value) {
+  struct Hash *h = &table->hash;
+
+  // Keep the load, counting tombstones, under 3/4.
+  if ((h->used + 1) * 4 > h->capacity * 3)
+    hash_resize(table, h->count * 2 >= h->capacity ? h->capacity * 2 : h->capacity);
+
+  struct HashEntry *entry = hash_find(table, key);
+
+  if (entry->key == NULL || entry->key == TOMBSTONE) {
+    if (entry->key == NULL)
+      h->used++;
+    h->count++;
+    entry->key = key;
+  }
+
+  entry->value = value;
+}
+
+int hash_remove(Object *table, Object *key) {
+  struct HashEntry *entry = hash_find(table, key);
+
+  if (entry->key == NULL || entry->key == TOMBSTONE)
+    return 0;
+
+  entry->key = TOMBSTONE;
+  entry->value = NULL;
+  table->hash.count--;
+  return 1;
+}
+
+/* Whether ENTRY holds a key rather than being empty or removed. */
+int hash_entry_live(struct HashEntry *entry) {
+  return entry->key != NULL && entry->key != TOMBSTONE;
+}
+
+void hash_mark(Object *table) {
+  struct Hash *h = &table->hash;
+
+  for (int i = 0; i < h->capacity; i++) {
+    if (h->entries[i].key != NULL && h->entries[i].key != TOMBSTONE) {
+      mark(h->entries[i].key);
+      mark(h->entries[i].value);
+    }
+  }
+}
+
+void hash_free(Object *table) {
+  free(table->hash.entries);
+  table->hash.entries = NULL;
+  table->hash.capacity = 0;
+  table->hash.count = 0;
+}
+
+Object *check_hash_table(Object *obj, char *msg) {
+  if (!is_hash_table(obj))
+    error(msg);
+
+  return obj;
+}
+
+/* (make-hash-table ['eq | 'equal]) */
+Object *primitive_make_hash_table(Object *args) {
+  Object *test = car(args);
+
+  if (test == s_nil ||
+      (is_symbol(test) && strcmp(test->symbol.name, "equal") == 0))
+    return make_hash_table(HASH_EQUAL);
+  if (is_symbol(test) && strcmp(test->symbol.name, "eq") == 0)
+    return make_hash_table(HASH_EQ);
+
+  error("make-hash-table: test must be eq or equal");
+  return s_nil;
+}
+
+/* (hash-ref table key [default]) */
+Object *primitive_hash_ref(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-ref: not a hash table");
+  Object *value = hash_get(table, cadr(args));
+
+  if (value == NULL)
+    return car(cddr(args));
+
+  return value;
+}
+
+Object *primitive_hash_set(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-set!: not a hash table");
+
+  check_writable(table);
+  hash_put(table, cadr(args), car(cddr(args)));
+  return car(cddr(args));
+}
+
+Object *primitive_hash_remove(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-remove!: not a hash table");
+
+  check_writable(table);
+  return hash_remove(table, cadr(args)) ? s_t : s_nil;
+}
+
+Object *primitive_hash_count(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-count: not a hash table");
+
+  return make_fixnum(table->hash.count);
+}
+
+Object *primitive_hash_keys(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-keys: not a hash table");
+  Object *list = s_nil;
+
+  pin_variable((void **)&table);
+  pin_variable((void **)&list);
+
+  for (int i = 0; i < table->hash.capacity; i++) {
+    Object *key = table->hash.entries[i].key;
+
+    if (key != NULL && key != TOMBSTONE)
+      list = cons(key, list);
+  }
+
+  unpin_variable((void **)&list);
+  unpin_variable((void **)&table);
+  return list;
+}
+
+/* (hash-for-each table fn)
+ * Calls FN with each key and value.  Adding or removing keys from
+ * inside FN may skip or repeat entries.
+ */
+Object *primitive_hash_for_each(Object *args) {
+  Object *table = check_hash_table(car(args), "hash-for-each: not a hash table");
+  Object *fn = cadr(args);
+  Object *fn_args = NULL;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&fn_args);
+
+  for (int i = 0; i < table->hash.capacity; i++) {
+    struct HashEntry *entry = &table->hash.entries[i];
+
+    if (entry->key == NULL || entry->key == TOMBSTONE)
+      continue;
+
+    fn_args = cons(entry->value, s_nil);
+    fn_args = cons(entry->key, fn_args);
+    apply(fn, fn_args, top_env);
+  }
+
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&args);
+  return s_nil;
+}
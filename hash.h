@@ -0,0 +1,27 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Hash tables.
+ *
+ */
+
+unsigned long hash_pointer(void *ptr);
+unsigned long hash_bytes(char *bytes, int len);
+
+void hash_mark(Object *table);
+void hash_free(Object *table);
+
+Object *make_hash_table(int test);
+Object *hash_get(Object *table, Object *key);
+void hash_put(Object *table, Object *key, Object *value);
+int hash_remove(Object *table, Object *key);
+int hash_entry_live(struct HashEntry *entry);
+
+Object *primitive_make_hash_table(Object *args);
+Object *primitive_hash_ref(Object *args);
+Object *primitive_hash_set(Object *args);
+Object *primitive_hash_remove(Object *args);
+Object *primitive_hash_count(Object *args);
+Object *primitive_hash_keys(Object *args);
+Object *primitive_hash_for_each(Object *args);
@@ -9,53 +9,134 @@
 
 #include "jcm-lisp.h"
 #include "gc.h"
-
+#include "array.h"
+#include "hash.h"
+#include "bignum.h"
+#include "profile.h"
+#include "alloc.h"
+#include "vmstats.h"
+#include "parallel.h"
+#include "optimize.h"
+#include "jit.h"
+#include "memo.h"
+#include "equal.h"
+#include "list.h"
+
+__thread struct Interp *interp;
+
+/* Embedders get the message back from interp_eval_string() and friends;
+ * otherwise errors end the process with status 1.
+ */
 void error(char *msg) {
-  printf("\nError %s\n", msg);
-  exit(0);
+  if (interp != NULL && interp->error_jump != NULL) {
+    snprintf(interp->error_message, sizeof(interp->error_message), "%s", msg);
+    longjmp(*interp->error_jump, 1);
+  }
+
+  if (interp != NULL && interp->quiet) {
+    fflush(stdout);
+    fprintf(stderr, "Error %s\n", msg);
+  } else {
+    printf("\nError %s\n", msg);
+  }
+  exit(1);
+}
+
+/* error() for an unbound SYM.  The message is formatted on the stack:
+ * error() copies it before it longjmps, and a malloc'd one would leak.
+ */
+void error_undefined(Object *sym) {
+  char buff[sizeof(interp->error_message)];
+
+  snprintf(buff, sizeof(buff), "Undefined symbol '%s'", sym->symbol.name);
+  error(buff);
+}
+
+char *type_name(obj_type type) {
+  switch (type) {
+    case NIL:
+      return "NIL";
+    case FIXNUM:
+      return "FIXNUM";
+    case BIGNUM:
+      return "BIGNUM";
+    case STRING:
+      return "STRING";
+    case SYMBOL:
+      return "SYMBOL";
+    case CELL:
+      return "CELL";
+    case PRIMITIVE:
+      return "PRIM";
+    case PROC:
+      return "PROC";
+    case VECTOR:
+      return "VECTOR";
+    case ARRAY:
+      return "ARRAY";
+    case HASHTABLE:
+      return "HASHTABLE";
+    default:
+      return "UNKNOWN";
+  }
 }
 
 char *get_type(Object *obj) {
+  return obj == NULL ? "NULL" : type_name(type_of(obj));
+}
+
+/* Immediates carry their type in the pointer, not in a header. */
+obj_type type_of(Object *obj) {
   if (obj == NULL)
-    return "NULL";
-  else if (obj->type == FIXNUM)
-    return "FIXNUM";
-  else if (obj->type == STRING)
-    return "STRING";
-  else if (obj->type == SYMBOL)
-    return "SYMBOL";
-  else if (obj->type == CELL)
-    return "CELL";
-  else if (obj->type == PRIMITIVE)
-    return "PRIM";
-  else if (obj->type == PROC)
-    return "PROC";
+    return UNKNOWN;
+  else if (is_immediate(obj))
+    return FIXNUM;
   else
-    return "UNKNOWN";
+    return obj->type;
 }
 
 int is_fixnum(Object *obj) {
-  return (obj && obj->type == FIXNUM);
+  return is_immediate(obj);
+}
+
+int is_bignum(Object *obj) {
+  return type_of(obj) == BIGNUM;
+}
+
+int is_number(Object *obj) {
+  return is_fixnum(obj) || is_bignum(obj);
 }
 
 int is_string(Object *obj) {
-  return (obj && obj->type == STRING);
+  return type_of(obj) == STRING;
 }
 
 int is_symbol(Object *obj) {
-  return (obj && obj->type == SYMBOL);
+  return type_of(obj) == SYMBOL;
 }
 
 int is_cell(Object *obj) {
-  return (obj && obj->type == CELL);
+  return type_of(obj) == CELL;
 }
 
 int is_primitive(Object *obj) {
-  return (obj && obj->type == PRIMITIVE);
+  return type_of(obj) == PRIMITIVE;
 }
 
 int is_proc(Object *obj) {
-  return (obj && obj->type == PROC);
+  return type_of(obj) == PROC;
+}
+
+int is_vector(Object *obj) {
+  return type_of(obj) == VECTOR;
+}
+
+int is_array(Object *obj) {
+  return type_of(obj) == ARRAY;
+}
+
+int is_hash_table(Object *obj) {
+  return type_of(obj) == HASHTABLE;
 }
 
 Object *car(Object *obj) {
@@ -73,12 +154,14 @@ Object *cdr(Object *obj) {
 }
 
 void setcar(Object *obj, Object *val) {
+  check_writable(obj);
   obj->cell.car = val;
 }
 
 void setcdr(Object *obj, Object *val) {
   if (obj == NULL)
     error("Cannot set NULL cdr");
+  check_writable(obj);
 
   if (obj->cell.cdr != NULL &&
       obj->cell.cdr != s_nil) {
@@ -88,15 +171,16 @@ void setcdr(Object *obj, Object *val) {
   obj->cell.cdr = val;
 }
 
-Object *new_Object() {
+Object *new_Object(obj_type type) {
 #ifdef GC_ENABLED
   Object *obj = alloc_Object();
 #else
   Object *obj = calloc(1, sizeof(Object));
 #endif // GC_ENABLED
 
-  obj->type = UNKNOWN;
+  obj->type = type;
   obj->mark = 0;
+  alloc_track(type);
 
 #ifdef GC_PIN_DEBUG
   printf("Allocated object %p\n", obj);
@@ -108,11 +192,11 @@ Object *make_cell() {
   Object *obj = NULL;
 
   pin_variable((void **)&obj);
-  obj = new_Object();
-
-  obj->type = CELL;
+  obj = new_Object(CELL);
   obj->cell.car = s_nil;
   obj->cell.cdr = s_nil;
+  obj->cell.cache = NULL;
+  obj->cell.callee = NULL;
   unpin_variable((void **)&obj);
   return obj;
 }
@@ -128,35 +212,42 @@ Object *cons(Object *car, Object *cdr) {
   return obj;
 }
 
-Object *make_string(char *str) {
+/* Copy LEN bytes of STR, so strings may hold embedded NULs. */
+Object *make_string_len(char *str, int len) {
   Object *obj = NULL;
 
   pin_variable((void **)&obj);
-  obj = new_Object();
-  obj->type = STRING;
-  obj->str.text = strdup(str);
+  obj = new_Object(STRING);
+  obj->str.text = malloc(len + 1);
+  assert(obj->str.text != NULL);
+  alloc_track_bytes(len + 1);
+  memcpy(obj->str.text, str, len);
+  obj->str.text[len] = '\0';
+  obj->str.len = len;
   unpin_variable((void **)&obj);
   return obj;
 }
 
-Object *make_fixnum(int n) {
-  Object *obj = NULL;
+Object *make_string(char *str) {
+  return make_string_len(str, strlen(str));
+}
 
-  pin_variable((void **)&obj);
-  obj = new_Object();
-  obj->type = FIXNUM;
-  obj->num.value = n;
-  unpin_variable((void **)&obj);
-  return obj;
+Object *make_fixnum(long n) {
+  if (n > FIXNUM_MAX || n < FIXNUM_MIN)
+    return bignum_from_long(n);
+
+  return (Object *)(((unsigned long)n << 1) | 1);
 }
 
 Object *make_symbol(char *name) {
   Object *obj = NULL;
 
   pin_variable((void **)&obj);
-  obj = new_Object();
-  obj->type = SYMBOL;
+  obj = new_Object(SYMBOL);
   obj->symbol.name = strdup(name);
+  obj->symbol.special = 0;
+  obj->symbol.local = 0;
+  alloc_track_bytes(strlen(name) + 1);
   unpin_variable((void **)&obj);
   return obj;
 }
@@ -165,9 +256,9 @@ Object *make_primitive(primitive_fn *fn) {
   Object *obj = NULL;
 
   pin_variable((void **)&obj);
-  obj = new_Object();
-  obj->type = PRIMITIVE;
+  obj = new_Object(PRIMITIVE);
   obj->primitive.fn = fn;
+  obj->primitive.name = NULL;
   unpin_variable((void **)&obj);
   return obj;
 }
@@ -176,16 +267,57 @@ Object *make_proc(Object *vars, Object *body, Object *env) {
   Object *obj = NULL;
 
   pin_variable((void **)&obj);
-  obj = new_Object();
-  obj->type = PROC;
+  obj = new_Object(PROC);
   obj->proc.vars = vars;
   obj->proc.body = body;
   obj->proc.env = env;
+  obj->proc.name = NULL;
+  obj->proc.macro = 0;
+  obj->proc.jit = 0;
   unpin_variable((void **)&obj);
   //printf("Made proc.\n");
   return obj;
 }
 
+/* Slots live in one contiguous block, all set to FILL. */
+Object *make_vector(int len, Object *fill) {
+  Object *obj = NULL;
+
+  pin_variable((void **)&fill);
+  pin_variable((void **)&obj);
+  obj = new_Object(VECTOR);
+  obj->vec.items = malloc((len > 0 ? len : 1) * sizeof(Object *));
+  assert(obj->vec.items != NULL);
+  alloc_track_bytes(len * sizeof(Object *));
+  obj->vec.len = len;
+
+  for (int i = 0; i < len; i++)
+    obj->vec.items[i] = fill;
+
+  unpin_variable((void **)&obj);
+  unpin_variable((void **)&fill);
+  return obj;
+}
+
+Object *list_to_vector(Object *list) {
+  Object *obj = NULL;
+  int len = 0;
+
+  for (Object *cell = list; is_cell(cell); cell = cdr(cell))
+    len++;
+
+  pin_variable((void **)&list);
+  obj = make_vector(len, s_nil);
+
+  for (int i = 0; i < len; i++) {
+    obj->vec.items[i] = car(list);
+    list = cdr(list);
+  }
+
+  unpin_variable((void **)&list);
+  return obj;
+}
+
 /* Walk linked list of symbols
  * for one matching name.
  */
@@ -197,8 +329,11 @@ Object *lookup_symbol(char *name) {
   printf("Symbol for lookup %s\n", name);
 #endif
 
+  vm_count(symbol_lookups);
+
   while (cell != s_nil) {
     sym = car(cell);
+    vm_count(symbol_steps);
 
 #ifdef GC_DEBUG_XX
     printf("Symbol for lookup comparison? %d %s\n", is_symbol(sym), sym->symbol.name);
@@ -232,7 +367,9 @@ Object *intern_symbol(char *name) {
     //printf("Make symbol %s\n", name);
     sym = make_symbol(name);
     //printf("Made symbol %p\n", sym);
+    pin_variable((void **)&sym);
     symbols = cons(sym, symbols);
+    unpin_variable((void **)&sym);
     //printf("Interned symbol %p\n", sym);
   }
 
@@ -241,72 +378,86 @@ Object *intern_symbol(char *name) {
 
 // BUG: Does not walk list of environments! (?)
 Object *assoc(Object *key, Object *list) {
-  if (list != s_nil) {
-    /* printf("Assoc:\n"); */
-    /* printf("key:\n"); */
-    /* print(key); */
+  vm_count(assoc_calls);
+
+  while (list != s_nil) {
     Object *pair = car(list);
-    /* printf("pair:\n"); */
-    /* print(pair); */
-    /* printf("Assoc check '%s' vs '%s'\n", car(pair)->symbol.name, key->symbol.name); */
-    //printf("Assoc check '%s' vs '%s'\n", key->symbol.name, car(pair)->symbol.name);
-    /* printf("\nAssoc check %p vs %p\n", car(pair), key); */
-    if (car(pair) == key) {
-      //printf("Found '%s'!\n", key->symbol.name);
+
+    vm_count(assoc_steps);
+    if (car(pair) == key)
       return pair;
-    }
 
-    //printf("Still looking....\n");
-    return assoc(key, cdr(list));
+    list = cdr(list);
   }
 
-  printf("Not found:  '%s'\n", key->symbol.name);
+  vm_count(assoc_misses);
+  if (!interp->quiet)
+    printf("Not found:  '%s'\n", key->symbol.name);
   return NULL;
 }
 
 Object *primitive_add(Object *args) {
-  int total = 0;
+  Object *total = make_fixnum(0);
 
   while (args != s_nil) {
-    total += car(args)->num.value;
+    if (!is_number(car(args)))
+      error("+: not a number");
+    total = number_add(total, car(args));
     args = cdr(args);
   }
 
-  return make_fixnum(total);
+  return total;
 }
 
 Object *primitive_sub(Object *args) {
-  long result = car(args)->num.value;
+  Object *result = car(args);
+
+  if (!is_number(result))
+    error("-: not a number");
 
   args = cdr(args);
   while (args != s_nil) {
-    result -= car(args)->num.value;
+    if (!is_number(car(args)))
+      error("-: not a number");
+    result = number_sub(result, car(args));
     args = cdr(args);
   }
 
-  return make_fixnum(result);
+  return result;
 }
 
 Object *primitive_mul(Object *args) {
-  long total = 1;
+  Object *total = make_fixnum(1);
 
   while (args != s_nil) {
-    total *= car(args)->num.value;
+    if (!is_number(car(args)))
+      error("*: not a number");
+    total = number_mul(total, car(args));
     args = cdr(args);
   }
 
-  return make_fixnum(total);
+  return total;
 }
 
 Object *primitive_div(Object *args) {
-  long dividend = car(args)->num.value;
-  long divisor = cadr(args)->num.value;
-  long quotient = 0;
+  if (!is_number(car(args)) || !is_number(cadr(args)))
+    error("/: not a number");
 
-  if (divisor != 0)
-    quotient = dividend / divisor;
+  return number_div(car(args), cadr(args));
+}
+
+Object *primitive_lt(Object *args) {
+  if (!is_number(car(args)) || !is_number(cadr(args)))
+    error("<: not a number");
 
-  return make_fixnum(quotient);
+  return number_compare(car(args), cadr(args)) < 0 ? s_t : s_nil;
+}
+
+Object *primitive_gt(Object *args) {
+  if (!is_number(car(args)) || !is_number(cadr(args)))
+    error(">: not a number");
+
+  return number_compare(car(args), cadr(args)) > 0 ? s_t : s_nil;
 }
 
 int is_whitespace(char c) {
@@ -318,15 +469,19 @@ int is_whitespace(char c) {
 
 int is_symbol_char(char c) {
   return (isalnum(c) ||
-          strchr("+-*/", c));
+          strchr("+-*/=<>!?:", c));
 }
 
+/* The reader uses getc_unlocked(): a stream is only ever read by the
+ * thread that owns the interpreter, so stdio's per-character locking
+ * buys nothing.
+ */
 void skip_whitespace(FILE *in) {
   char c;
   int done = 0;
 
   while (!done) {
-    c = getc(in);
+    c = getc_unlocked(in);
     if (c == '\n' || c == '\r')
       done = 1;
 
@@ -342,8 +497,8 @@ void skip_comment(FILE *in) {
   int done = 0;
 
   while (!done) {
-    c = getc(in);
-    if (c == '\n' || c == '\r')
+    c = getc_unlocked(in);
+    if (c == '\n' || c == '\r' || c == EOF)
       done = 1;
   }
 }
@@ -353,7 +508,7 @@ Object *read_string(FILE *in) {
   int i = 0;
   char c;
 
-  while ((c = getc(in)) != '"' &&
+  while ((c = getc_unlocked(in)) != '"' &&
          i < MAX_BUFFER_SIZE - 1) {
     buffer[i++] = c;
   }
@@ -362,37 +517,74 @@ Object *read_string(FILE *in) {
   return make_string(buffer);
 }
 
-Object *read_symbol(FILE *in) {
-  char buffer[MAX_BUFFER_SIZE];
+int is_token_char(char c) {
+  return !is_whitespace(c) && is_symbol_char(c);
+}
+
+int is_digit_char(char c) {
+  return isdigit(c);
+}
+
+/* Read characters while ACCEPT holds into a malloc'd buffer, grown as
+ * needed so integer literals have no length limit.  The caller frees
+ * the result.
+ */
+char *read_token(FILE *in, int (*accept)(char)) {
+  int size = MAX_BUFFER_SIZE;
+  char *buffer = malloc(size);
   int i = 0;
   char c;
 
-  while (!is_whitespace(c = getc(in)) &&
-         is_symbol_char(c) &&
-         i < MAX_BUFFER_SIZE - 1) {
+  assert(buffer != NULL);
+
+  while (accept(c = getc_unlocked(in))) {
+    if (i == size - 1) {
+      size *= 2;
+      buffer = realloc(buffer, size);
+      assert(buffer != NULL);
+    }
     buffer[i++] = c;
   }
 
   buffer[i] = '\0';
   ungetc(c, in);
+  return buffer;
+}
+
+Object *read_symbol(FILE *in) {
+  char *buffer = read_token(in, is_token_char);
+
+  // Signed literals such as -12 start out looking like symbols.
+  Object *obj = parse_integer(buffer);
 
-  Object *obj = intern_symbol(buffer);
+  if (obj == NULL)
+    obj = intern_symbol(buffer);
 
+  free(buffer);
   return obj;
 }
 
 Object *read_number(FILE *in) {
-  int number = 0;
-  char c;
+  char *buffer = read_token(in, is_digit_char);
+  Object *obj = parse_integer(buffer);
 
-  while (isdigit(c = getc(in))) {
-    number *= 10;
-    number += (int)c - 48;
-  }
+  free(buffer);
+  return obj;
+}
 
-  ungetc(c, in);
+/* Read the elements of #(...) once the '#' is consumed. */
+Object *read_vector(FILE *in) {
+  if (getc_unlocked(in) != '(')
+    error("Expected '(' after '#'");
+
+  skip_whitespace(in);
+  char c = getc_unlocked(in);
 
-  return make_fixnum(number);
+  if (c == ')')
+    return make_vector(0, s_nil);
+
+  ungetc(c, in);
+  return list_to_vector(read_list(in));
 }
 
 // XXX Review these: strchr, strdup, strcmp, strspn, atoi
@@ -401,7 +593,7 @@ Object *read_lisp(FILE *in) {
   pin_variable((void **)&obj);
 
   skip_whitespace(in);
-  char c = getc(in);
+  char c = getc_unlocked(in);
 
   if (c == '\'') {
     obj = cons(s_quote, cons(read_lisp(in), s_nil));
@@ -409,11 +601,13 @@ Object *read_lisp(FILE *in) {
     obj = read_list(in);
   } else if (c == '"') {
     obj = read_string(in);
+  } else if (c == '#') {
+    obj = read_vector(in);
   } else if (isdigit(c)) {
     ungetc(c, in);
     obj = read_number(in);
   } else if (isalpha(c) ||
-             strchr("+-/*", c)) {
+             strchr("+-/*=<>!?:", c)) {
     ungetc(c, in);
     obj = read_symbol(in);
   } else if (c == ')') {
@@ -421,12 +615,7 @@ Object *read_lisp(FILE *in) {
   } else if (c == ';') {
     skip_comment(in);
   } else if (c == EOF) {
-#ifdef REPL
-    exit(0);
-#else
-    printf("EOL\n");
-    return NULL;
-#endif
+    obj = NULL;
   }
 
   unpin_variable((void **)&obj);
@@ -444,14 +633,17 @@ Object *read_list(FILE *in) {
 
   char c;
 
-  while ((c = getc(in)) != ')') {
+  while ((c = getc_unlocked(in)) != ')') {
+    if (c == EOF)
+      error("End of file inside a list");
+
     if (c == '.') {
       // Discard the char after '.'
       // but we should check for whitespace.
-      getc(in);
+      getc_unlocked(in);
 
-      // The rest goes into the cdr.
-      car->cell.cdr = read_lisp(in);
+      // The rest goes into the cdr of the last cell.
+      cdr->cell.cdr = read_lisp(in);
     } else if (!is_whitespace(c)) {
       ungetc(c, in);
 
@@ -488,6 +680,18 @@ Object *extend(Object *env, Object *var, Object *val) {
   return result;
 }
 
+/* extend() for a lambda, let or loop frame.  Marks VAR as bound
+ * locally, so call sites naming it are never cached (see
+ * eval_operator()).  A parallel-map worker leaves its caller's symbols
+ * alone; workers do not use the caches.
+ */
+Object *extend_local(Object *env, Object *var, Object *val) {
+  if (is_symbol(var) && in_heap(var))
+    var->symbol.local = 1;
+
+  return extend(env, var, val);
+}
+
 void print_env(Object *env) {
   Object *head = car(env);
 
@@ -510,11 +714,21 @@ void print_env(Object *env) {
 }
 
 
+/* The first name a proc or primitive is defined as, for the profiler. */
+void name_procedure(Object *val, Object *name) {
+  if (is_proc(val) && val->proc.name == NULL && in_heap(val))
+    val->proc.name = name;
+  else if (is_primitive(val) && val->primitive.name == NULL && in_heap(val))
+    val->primitive.name = name;
+}
+
 /*
  * Set the tail of this env to a new list
  * with var and val at the head.
  */
 Object *extend_top(Object *var, Object *val) {
+  name_procedure(val, var);
+
   Object *current_top = cdr(top_env);
   Object *updated_top = extend(current_top, var, val);
 
@@ -525,16 +739,42 @@ Object *extend_top(Object *var, Object *val) {
 
 Object *eval(Object *obj, Object *env);
 
-/* Return list of evaluated args. */
+/* Return list of evaluated args.
+ * The list is built front to back and stays pinned, so a GC
+ * triggered by a later argument cannot free the earlier ones.
+ */
 Object *eval_args(Object *args, Object *env) {
-  if (args != s_nil)
-    return cons(eval(car(args), env), eval_args(cdr(args), env));
+  Object *head = s_nil;
+  Object *tail = NULL;
+  Object *val = NULL;
 
-  return s_nil;
+  pin_variable((void **)&head);
+  pin_variable((void **)&val);
+
+  while (args != s_nil) {
+    val = eval(car(args), env);
+
+    if (head == s_nil) {
+      head = tail = cons(val, s_nil);
+    } else {
+      setcdr(tail, cons(val, s_nil));
+      tail = cdr(tail);
+    }
+
+    args = cdr(args);
+  }
+
+  unpin_variable((void **)&val);
+  unpin_variable((void **)&head);
+
+  return head;
 }
 
 Object *progn(Object *forms, Object *env) {
-  printf("progn\n");
+  int trace = !interp->quiet;
+
+  if (trace)
+    printf("progn\n");
   //print_env(env);
 
   if (forms == s_nil)
@@ -544,8 +784,10 @@ Object *progn(Object *forms, Object *env) {
     if (cdr(forms) == s_nil)
     {
       //printf("Eval 1 in progn: ");
-      print(car(forms));
-      printf("\n");
+      if (trace) {
+        print(car(forms));
+        printf("\n");
+      }
       Object *temp = eval(car(forms), env);
       //printf("\n------------------> End of progn:\n");
       //print_env(env);
@@ -556,21 +798,37 @@ Object *progn(Object *forms, Object *env) {
 
     //printf("Eval 2 in progn: ");
     eval(car(forms), env);
-    print(car(forms));
-    printf("\nRecurse in progn: ");
-    print(cdr(forms));
-    printf("\n");
+    if (trace) {
+      print(car(forms));
+      printf("\nRecurse in progn: ");
+      print(cdr(forms));
+      printf("\n");
+    }
     forms = cdr(forms);
   }
   return s_nil;
 }
 
-/* Iterate vars and vals, adding each pair to this env. */
+/* Iterate vars and vals, adding each pair to this env.  A dotted tail,
+ * as in (a b . rest), is bound to the list of the remaining vals.
+ */
 Object *multiple_extend_env(Object *env, Object *vars, Object *vals) {
-  if (vars == s_nil)
-    return env;
-  else
-    return multiple_extend_env(extend(env, car(vars), car(vals)), cdr(vars), cdr(vals));
+  pin_variable((void **)&env);
+
+  while (vars != s_nil) {
+    if (!is_cell(vars)) {
+      env = extend_local(env, vars, vals);
+      break;
+    }
+
+    env = extend_local(env, car(vars), car(vals));
+    vars = cdr(vars);
+    vals = cdr(vals);
+  }
+
+  unpin_variable((void **)&env);
+
+  return env;
 }
 
 Object *apply(Object *obj, Object *args, Object *env) {
@@ -579,12 +837,31 @@ Object *apply(Object *obj, Object *args, Object *env) {
 
   if (is_primitive(obj)) {
     //printf("Boring prim\n");
-    return (*obj->primitive.fn)(args);
+    vm_count(apply_primitive);
+    profile_push(obj->primitive.name != NULL ? obj->primitive.name : s_lambda);
+    Object *result = (*obj->primitive.fn)(args);
+    profile_pop();
+    return result;
   }
 
   if (is_proc(obj)) {
     //printf("Look out!\n");
-    return progn(obj->proc.body, multiple_extend_env(obj->proc.env, obj->proc.vars, args));
+    vm_count(apply_proc);
+    Object *result = jit_apply(obj, args);
+
+    if (result != NULL)
+      return result;
+
+    Object *frame = NULL;
+    pin_variable((void **)&frame);
+
+    profile_push(obj->proc.name != NULL ? obj->proc.name : s_lambda);
+    frame = multiple_extend_env(obj->proc.env, obj->proc.vars, args);
+    result = progn(obj->proc.body, frame);
+    profile_pop();
+
+    unpin_variable((void **)&frame);
+    return result;
   }
 
   // If this is neither a primitive function nor a proc,
@@ -593,9 +870,12 @@ Object *apply(Object *obj, Object *args, Object *env) {
   print(obj);
   printf("\n");
 
+  if (is_immediate(obj))
+    error("Bad apply");
+
   printf("Proc vars:\n");
   printf("Proc vars pointer: %p\n", obj->proc.vars);
-  printf("Proc vars type: %d\n", obj->proc.vars->type);
+  printf("Proc vars type: %d\n", type_of(obj->proc.vars));
   print(obj->proc.vars);
   printf("Proc body:\n");
   print(obj->proc.body);
@@ -607,108 +887,601 @@ Object *apply(Object *obj, Object *args, Object *env) {
   return s_nil;
 }
 
+/* Keywords such as :max-entries evaluate to themselves. */
 Object *eval_symbol(Object *obj, Object *env) {
+  if (obj->symbol.name[0] == ':')
+    return obj;
+
   Object *pair = assoc(obj, env);
 
   if (pair == NULL) {
-    char *buff = NULL;
-    asprintf(&buff, "Undefined symbol '%s'", obj->symbol.name);
-    error(buff);
+    error_undefined(obj);
   }
 
   return cdr(pair);
 }
 
-Object *eval_list(Object *obj, Object *env) {
-  if (obj == s_nil)
-    return obj;
+/* Bind VAR to VAL the way define does: set it if it is already bound
+ * in ENV, else add it to the top level environment.
+ */
+Object *define_variable(Object *var, Object *val, Object *env) {
+  // Check for existing binding?
+  Object *pair = assoc(var, env);
 
-  if (car(obj) == s_define) {
-    Object *cell = obj; // car(cell) should be symbol named define
+  if (pair == NULL) {
+    if (!interp->quiet) {
+      printf("Creating new binding: ");
+      print(var);
+      printf("\n");
+    }
 
-    cell = cdr(cell);
-    Object *cell_symbol = car(cell);
+    pin_variable((void **)&val);
+    extend_top(var, val);
+    unpin_variable((void **)&val);
+    return val;
+  } else {
+    name_procedure(val, var);
+    setcdr(pair, val);
 
-    cell = cdr(cell);
-    Object *cell_value = car(cell);
+    return val;
+  }
+}
 
-    Object *val = eval(cell_value, env);
+/* (define var value) binds var in the top level environment, or sets
+ * it if it is already bound where the form is evaluated.
+ */
+Object *eval_define(Object *obj, Object *env) {
+  vm_count(form_define);
+  Object *cell = obj; // car(cell) should be symbol named define
 
-    // Check for existing binding?
-    Object *pair = assoc(cell_symbol, env);
+  cell = cdr(cell);
+  Object *cell_symbol = car(cell);
 
-    if (pair == NULL) {
-      printf("Creating new binding: ");
-      print(cell_symbol);
-      printf("\n");
-      Object *var = cell_symbol;
-      return extend_top(var, val);
+  cell = cdr(cell);
+  Object *cell_value = car(cell);
+
+  Object *val = eval(cell_value, env);
+
+  return define_variable(cell_symbol, val, env);
+}
+
+Object *eval_setq(Object *obj, Object *env) {
+  vm_count(form_setq);
+  //printf("SETQ\n");
+  Object *cell = obj; // car(cell) should be symbol named setq
+  //print(cell);
+
+  cell = cdr(cell);
+  Object *cell_symbol = car(cell);
+  //print(cell_symbol);
+
+  cell = cdr(cell);
+  Object *cell_value = car(cell);
+  //print(cell_value);
+
+  Object *pair = assoc(cell_symbol, env);
+
+  if (pair == NULL)
+    error("SETQ failed to find symbol in env.");
+
+  Object *newval = eval(cell_value, env);
+
+  setcdr(pair, newval);
+
+  return newval;
+}
+
+Object *eval_if(Object *obj, Object *env) {
+  vm_count(form_if);
+  Object *cell = obj;
+
+  cell = cdr(cell);
+  Object *cell_condition = car(cell);
+
+  cell = cdr(cell);
+  Object *cell_true_branch = car(cell);
+
+  cell = cdr(cell);
+  Object *cell_false_branch = car(cell);
+
+  if (eval(cell_condition, env) != s_nil)
+    return eval(cell_true_branch, env);
+  else
+    return eval(cell_false_branch, env);
+}
+
+Object *eval_quote(Object *obj, Object *env) {
+  vm_count(form_quote);
+  return cadr(obj);
+}
+
+/* Whether SYM is one of PARAMS, or their dotted tail. */
+int is_param(Object *sym, Object *params) {
+  for (; is_cell(params); params = params->cell.cdr) {
+    if (params->cell.car == sym)
+      return 1;
+  }
+
+  return params == sym;
+}
+
+/* Whether FORM is a call to a macro defined at the top level. */
+int is_macro_call(Object *form) {
+  Object *op = form->cell.car;
+  Object *value = is_symbol(op) ? global_value(op) : NULL;
+
+  return value != NULL && is_proc(value) && value->proc.macro;
+}
+
+/* NAMES with each symbol in FORM that is not in PARAMS or NAMES added,
+ * or s_t if FORM calls a macro, whose expansion may mention anything.
+ */
+Object *collect_symbols(Object *form, Object *params, Object *names) {
+  if (is_cell(form) && is_macro_call(form))
+    return s_t;
+
+  pin_variable((void **)&form);
+  pin_variable((void **)&names);
+
+  while (is_cell(form) && names != s_t) {
+    names = collect_symbols(form->cell.car, params, names);
+    form = form->cell.cdr;
+  }
+
+  if (is_symbol(form) && form != s_nil && names != s_t &&
+      !is_param(form, params) && !is_param(form, names))
+    names = cons(form, names);
+
+  unpin_variable((void **)&names);
+  unpin_variable((void **)&form);
+  return names;
+}
+
+/* The environment for a closure made by the lambda form OBJ in ENV:
+ * the bindings of the local variables its body mentions, ahead of the
+ * top level, instead of every enclosing frame, so a closure does not
+ * keep unrelated locals alive.  The binding pairs are shared rather
+ * than copied, so a setq through the closure or the frame it came from
+ * is seen by both.
+ *
+ * The first time the form is evaluated its body is optimized (see
+ * optimize.c), and the symbols the body then mentions are kept in the
+ * form, with the macro_count at the time.  Only those ever bound
+ * locally (see extend_local()) can be in a local frame.  A body that
+ * calls a macro keeps all of ENV, since the expansion is not known
+ * until the call runs; the names are collected again after a
+ * defmacro, which may have made a call in the body a macro call.
+ */
+Object *closure_env(Object *obj, Object *env) {
+  Object *cached = obj->cell.cache;
+  Object *names = NULL;
+  Object *result = NULL;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&env);
+  pin_variable((void **)&names);
+  pin_variable((void **)&result);
+
+  if (cached != NULL && fixnum_value(car(cached)) == interp->macro_count) {
+    names = cdr(cached);
+  } else {
+    if (cached == NULL && in_heap(obj) && interp->parent == NULL)
+      optimize_list(cddr(obj), cadr(obj));
+    names = collect_symbols(cddr(obj), cadr(obj), s_nil);
+    if (in_heap(obj))
+      obj->cell.cache = cons(make_fixnum(interp->macro_count), names);
+  }
+
+  result = top_env;
+  if (names == s_t && env != top_env)
+    result = env;
+  if (env == top_env || names == s_t)
+    names = s_nil;
+
+  for (Object *l = names; l != s_nil; l = l->cell.cdr) {
+    Object *name = l->cell.car;
+
+    // parallel-map workers do not mark their callers' symbols.
+    if (!name->symbol.local && interp->parent == NULL)
+      continue;
+
+    for (Object *frame = env; frame != top_env && is_cell(frame); frame = frame->cell.cdr) {
+      if (caar(frame) == name) {
+        result = cons(frame->cell.car, result);
+        break;
+      }
+    }
+  }
+
+  unpin_variable((void **)&result);
+  unpin_variable((void **)&names);
+  unpin_variable((void **)&env);
+  unpin_variable((void **)&obj);
+  return result;
+}
+
+Object *eval_lambda(Object *obj, Object *env) {
+  vm_count(form_lambda);
+  Object *vars = cadr(obj);
+  Object *body = cddr(obj);
+  Object *captured = NULL;
+
+  pin_variable((void **)&captured);
+  captured = closure_env(obj, env);
+  Object *proc = make_proc(vars, body, captured);
+  unpin_variable((void **)&captured);
+
+  return proc;
+}
+
+/* (let ((var init) ...) body...) evaluates every init in the enclosing
+ * environment, then the body with the vars bound to the values.  A
+ * bare var is bound to nil.
+ */
+Object *eval_let(Object *obj, Object *env) {
+  vm_count(form_let);
+  Object *frame = NULL;
+  Object *val = NULL;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&env);
+  pin_variable((void **)&frame);
+  pin_variable((void **)&val);
+
+  frame = env;
+  for (Object *bindings = cadr(obj); is_cell(bindings); bindings = cdr(bindings)) {
+    Object *binding = car(bindings);
+
+    if (is_cell(binding)) {
+      val = eval(cadr(binding), env);
+      frame = extend_local(frame, car(binding), val);
     } else {
-      setcdr(pair, val);
+      frame = extend_local(frame, binding, s_nil);
+    }
+  }
 
-      return val;
+  val = progn(cddr(obj), frame);
+
+  unpin_variable((void **)&val);
+  unpin_variable((void **)&frame);
+  unpin_variable((void **)&env);
+  unpin_variable((void **)&obj);
+  return val;
+}
+
+/* (cond (test body...) ...) evaluates the body of the first clause whose
+ * test is not nil, or returns the test's value if the body is empty.
+ * A test of t always succeeds.
+ */
+Object *eval_cond(Object *obj, Object *env) {
+  vm_count(form_cond);
+
+  for (Object *clauses = cdr(obj); is_cell(clauses); clauses = cdr(clauses)) {
+    Object *clause = car(clauses);
+    Object *test = car(clause) == s_t ? s_t : eval(car(clause), env);
+
+    if (test != s_nil)
+      return cdr(clause) == s_nil ? test : progn(cdr(clause), env);
+  }
+
+  return s_nil;
+}
+
+/* (and form...) => nil at the first nil form, else the last value. */
+Object *eval_and(Object *obj, Object *env) {
+  vm_count(form_and);
+  Object *val = s_t;
+
+  for (Object *forms = cdr(obj); is_cell(forms); forms = cdr(forms)) {
+    val = eval(car(forms), env);
+    if (val == s_nil)
+      break;
+  }
+
+  return val;
+}
+
+/* (or form...) => the first value that is not nil, else nil. */
+Object *eval_or(Object *obj, Object *env) {
+  vm_count(form_or);
+  Object *val = s_nil;
+
+  for (Object *forms = cdr(obj); is_cell(forms); forms = cdr(forms)) {
+    val = eval(car(forms), env);
+    if (val != s_nil)
+      break;
+  }
+
+  return val;
+}
+
+/* (while test body...) evaluates body until test is nil; returns nil. */
+Object *eval_while(Object *obj, Object *env) {
+  vm_count(form_while);
+  Object *test = cadr(obj);
+  Object *body = cddr(obj);
+
+  while (eval(test, env) != s_nil) {
+    for (Object *forms = body; is_cell(forms); forms = cdr(forms))
+      eval(car(forms), env);
+  }
+
+  return s_nil;
+}
+
+/* (dotimes (var count [result]) body...) evaluates body with var bound
+ * to 0 .. count-1, then returns result (evaluated with var = count) or
+ * nil.  The binding is made once and updated in place, so the loop
+ * itself allocates nothing per iteration.
+ */
+Object *eval_dotimes(Object *obj, Object *env) {
+  vm_count(form_dotimes);
+  Object *spec = cadr(obj);
+  Object *body = cddr(obj);
+  Object *frame = NULL;
+  Object *count = NULL;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&frame);
+
+  count = eval(cadr(spec), env);
+  if (!is_fixnum(count))
+    error("dotimes: count is not an integer");
+
+  frame = extend_local(env, car(spec), make_fixnum(0));
+  Object *binding = car(frame);
+
+  for (long i = 0; i < fixnum_value(count); i++) {
+    binding->cell.cdr = make_fixnum(i);
+    for (Object *forms = body; is_cell(forms); forms = cdr(forms))
+      eval(car(forms), frame);
+  }
+
+  binding->cell.cdr = count;
+  Object *result = eval(car(cddr(spec)), frame);
+
+  unpin_variable((void **)&frame);
+  unpin_variable((void **)&obj);
+  return result;
+}
+
+/* (do ((var init step) ...) (test result...) body...) binds each var to
+ * its init, then until test is not nil evaluates body and sets every
+ * var that has a step to the step's value, evaluating all the steps
+ * before any var changes.  Returns the last result, or nil.  The
+ * bindings, and vectors of them and of their next values, are made
+ * once per loop rather than per iteration.
+ */
+Object *eval_do(Object *obj, Object *env) {
+  vm_count(form_do);
+  Object *specs = cadr(obj);
+  Object *exit = car(cddr(obj));
+  Object *body = cdr(cddr(obj));
+  Object *frame = NULL;
+  Object *pairs = NULL;
+  Object *steps = NULL;
+  Object *val = NULL;
+  int count = 0;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&env);
+  pin_variable((void **)&frame);
+  pin_variable((void **)&pairs);
+  pin_variable((void **)&steps);
+  pin_variable((void **)&val);
+
+  for (Object *l = specs; is_cell(l); l = cdr(l))
+    count++;
+
+  pairs = make_vector(count, s_nil);
+  steps = make_vector(count, s_nil);
+
+  frame = env;
+  Object *l = specs;
+  for (int i = 0; i < count; i++, l = cdr(l)) {
+    val = eval(cadr(car(l)), env);
+    frame = extend_local(frame, caar(l), val);
+    pairs->vec.items[i] = car(frame);
+  }
+
+  while (eval(car(exit), frame) == s_nil) {
+    for (Object *forms = body; is_cell(forms); forms = cdr(forms))
+      eval(car(forms), frame);
+
+    l = specs;
+    for (int i = 0; i < count; i++, l = cdr(l)) {
+      Object *step = cddr(car(l));
+
+      val = is_cell(step) ? eval(car(step), frame) : cdr(pairs->vec.items[i]);
+      steps->vec.items[i] = val;
     }
-  } else if (car(obj) == s_setq) {
-    //printf("SETQ\n");
-    Object *cell = obj; // car(cell) should be symbol named setq
-    //print(cell);
 
-    cell = cdr(cell);
-    Object *cell_symbol = car(cell);
-    //print(cell_symbol);
+    for (int i = 0; i < count; i++)
+      pairs->vec.items[i]->cell.cdr = steps->vec.items[i];
+  }
 
-    cell = cdr(cell);
-    Object *cell_value = car(cell);
-    //print(cell_value);
+  val = s_nil;
+  for (Object *forms = cdr(exit); is_cell(forms); forms = cdr(forms))
+    val = eval(car(forms), frame);
 
-    Object *pair = assoc(cell_symbol, env);
+  unpin_variable((void **)&val);
+  unpin_variable((void **)&steps);
+  unpin_variable((void **)&pairs);
+  unpin_variable((void **)&frame);
+  unpin_variable((void **)&env);
+  unpin_variable((void **)&obj);
+  return val;
+}
 
-    if (pair == NULL)
-      error("SETQ failed to find symbol in env.");
+/* (defmacro name (params) body...) defines name as a macro: a procedure
+ * called on the unevaluated arguments of a form that names it, whose
+ * result is evaluated in the form's place.  See expand_macro().
+ */
+Object *eval_defmacro(Object *obj, Object *env) {
+  vm_count(form_defmacro);
+  Object *macro = NULL;
+
+  pin_variable((void **)&macro);
+  macro = make_proc(car(cddr(obj)), cdr(cddr(obj)), env);
+  macro->proc.macro = 1;
+  define_variable(cadr(obj), macro, env);
+  interp->macro_count++;
+  unpin_variable((void **)&macro);
+
+  return macro;
+}
 
-    Object *newval = eval(cell_value, env);
+/* Expand the call site OBJ of MACRO and overwrite it with the
+ * expansion, so a site is expanded only the first time it runs and
+ * afterwards costs the same as the code it expanded to.  An expansion
+ * that is not a list becomes (begin expansion).  Code a parallel-map
+ * worker does not own is left alone and expanded each time.
+ */
+Object *expand_macro(Object *macro, Object *obj, Object *env) {
+  vm_count(macro_expansions);
+  Object *expansion = NULL;
 
-    setcdr(pair, newval);
+  pin_variable((void **)&obj);
+  pin_variable((void **)&expansion);
 
-    return newval;
-  } else if (car(obj) == s_if) {
-    Object *cell = obj;
+  expansion = apply(macro, cdr(obj), env);
 
-    cell = cdr(cell);
-    Object *cell_condition = car(cell);
+  if (in_heap(obj)) {
+    if (!is_cell(expansion))
+      expansion = cons(intern_symbol("begin"), cons(expansion, s_nil));
 
-    cell = cdr(cell);
-    Object *cell_true_branch = car(cell);
+    obj->cell.car = expansion->cell.car;
+    obj->cell.cdr = expansion->cell.cdr;
+    obj->cell.cache = NULL;
+    obj->cell.callee = NULL;
+    expansion = obj;
+  }
 
-    cell = cdr(cell);
-    Object *cell_false_branch = car(cell);
+  unpin_variable((void **)&expansion);
+  unpin_variable((void **)&obj);
+  return expansion;
+}
 
-    if (eval(cell_condition, env) != s_nil)
-      return eval(cell_true_branch, env);
-    else
-      return eval(cell_false_branch, env);
+/* (begin form...) => the value of the last form. */
+Object *eval_begin(Object *obj, Object *env) {
+  vm_count(form_begin);
+  return progn(cdr(obj), env);
+}
 
-  } else if (car(obj) == s_quote) {
-    return cadr(obj);
-  } else if (car(obj) == s_lambda) {
-    Object *vars = cadr(obj);
-    Object *body = cddr(obj);
+/* Special forms take the unevaluated form.  interp_new() stores each
+ * one's index in its symbol, so eval_list() finds the handler with one
+ * load rather than a compare per form; index 0 means an ordinary call.
+ * To add a form, write its eval_ function and add it here.
+ */
+typedef Object *special_fn(Object *obj, Object *env);
+
+struct SpecialForm {
+  char *name;
+  special_fn *fn;
+};
+
+static struct SpecialForm special_forms[] = {
+  { NULL, NULL },
+  { "quote", eval_quote },
+  { "if", eval_if },
+  { "define", eval_define },
+  { "setq", eval_setq },
+  { "lambda", eval_lambda },
+  { "let", eval_let },
+  { "cond", eval_cond },
+  { "and", eval_and },
+  { "or", eval_or },
+  { "while", eval_while },
+  { "dotimes", eval_dotimes },
+  { "do", eval_do },
+  { "begin", eval_begin },
+  { "defmacro", eval_defmacro },
+  { NULL, NULL }
+};
+
+void define_special_forms() {
+  for (int i = 1; special_forms[i].name != NULL; i++)
+    intern_symbol(special_forms[i].name)->symbol.special = i;
+}
 
-    //printf("Create lambda with env:\n");
-    //print_env(env);
-    //printf("\n");
-    return make_proc(vars, body, env);
+/* The procedure the call site OBJ applies.  An operator symbol that is
+ * never bound locally can only name a global, so the first call leaves
+ * its binding and value in the cell (an inline cache) and later calls
+ * skip the lookup while the binding still holds that value.  define or
+ * setq of the global changes the value, so the next call misses and
+ * caches afresh.  parallel-map workers, which cannot mark their
+ * callers' symbols as local, neither use nor fill the caches.
+ */
+Object *eval_operator(Object *obj, Object *env) {
+  Object *op = obj->cell.car;
+  Object *binding = obj->cell.cache;
+  int cacheable = is_symbol(op) && !op->symbol.local && interp->parent == NULL;
+
+  if (binding != NULL && cacheable &&
+      binding->cell.car == op &&
+      binding->cell.cdr == obj->cell.callee) {
+    vm_count(call_cache_hits);
+    return obj->cell.callee;
   }
 
+  if (!is_symbol(op))
+    return eval(op, env);
+
+  vm_count(call_cache_misses);
+  binding = assoc(op, env);
+
+  if (binding == NULL) {
+    error_undefined(op);
+  }
+
+  Object *callee = binding->cell.cdr;
+
+  if (cacheable && (is_primitive(callee) || is_proc(callee))) {
+    obj->cell.cache = binding;
+    obj->cell.callee = callee;
+  }
+
+  return callee;
+}
+
+Object *eval_list(Object *obj, Object *env) {
+  if (obj == s_nil)
+    return obj;
+
+  Object *op = car(obj);
+
+  if (type_of(op) == SYMBOL && op->symbol.special != 0)
+    return special_forms[op->symbol.special].fn(obj, env);
+
   /* This list is not a builtin, so treat it as a function call. */
-  Object *proc = eval(car(obj), env);
-  Object *args = eval_args(cdr(obj), env);
+  vm_count(form_call);
+  Object *proc = NULL;
+  Object *args = NULL;
+  pin_variable((void **)&proc);
+  pin_variable((void **)&args);
+
+  proc = eval_operator(obj, env);
+
+  if (is_proc(proc) && proc->proc.macro) {
+    args = expand_macro(proc, obj, env);
+    Object *result = eval(args, env);
+
+    unpin_variable((void **)&args);
+    unpin_variable((void **)&proc);
+    return result;
+  }
+
+  args = eval_args(cdr(obj), env);
 
   //printf("Fall-through assuming proc (apply).\n");
   //printf("Fall-through assuming proc with env %p:\n", env);
   //print_env(env);
   //printf("\n");
-  return apply(proc, args, env);
+  Object *result = apply(proc, args, env);
+
+  unpin_variable((void **)&args);
+  unpin_variable((void **)&proc);
+  return result;
 }
 
 Object *eval(Object *obj, Object *env) {
@@ -723,11 +1496,17 @@ Object *eval(Object *obj, Object *env) {
 
   Object *result = s_nil;
 
-  switch (obj->type) {
+  vm_count(evals[type_of(obj)]);
+
+  switch (type_of(obj)) {
     case STRING:
     case FIXNUM:
+    case BIGNUM:
     case PRIMITIVE:
     case PROC:
+    case VECTOR:
+    case ARRAY:
+    case HASHTABLE:
       result = obj;
       break;
     case SYMBOL:
@@ -745,21 +1524,20 @@ Object *eval(Object *obj, Object *env) {
 }
 
 void print_string(Object *obj) {
-  char *str = obj->str.text;
-  int len = strlen(str);
-  int i = 0;
-
   putchar('"');
-  while (i < len) {
-    putc(*str++, stdout);
-    i++;
-  }
-
+  fwrite(obj->str.text, 1, obj->str.len, stdout);
   putchar('"');
 }
 
 void print_fixnum(Object *obj) {
-  printf("%d", obj->num.value);
+  printf("%ld", fixnum_value(obj));
+}
+
+void print_bignum(Object *obj) {
+  char *str = integer_to_string(obj);
+
+  fputs(str, stdout);
+  free(str);
 }
 
 void print_cell(Object *car) {
@@ -768,7 +1546,7 @@ void print_cell(Object *car) {
   printf("(");
 
   while (obj != s_nil && obj != NULL) {
-    if (obj->type == CELL) {
+    if (is_cell(obj)) {
       print(obj->cell.car);
     } else {
       printf(". ");
@@ -785,16 +1563,31 @@ void print_cell(Object *car) {
   printf(")");
 }
 
+void print_vector(Object *obj) {
+  printf("#(");
+
+  for (int i = 0; i < obj->vec.len; i++) {
+    if (i > 0)
+      printf(" ");
+    print(obj->vec.items[i]);
+  }
+
+  printf(")");
+}
+
 void print(Object *obj) {
   if (obj == NULL) {
     printf("NULL OBJECT\n");
     return;
   }
 
-  switch (obj->type) {
+  switch (type_of(obj)) {
     case FIXNUM:
       print_fixnum(obj);
       break;
+    case BIGNUM:
+      print_bignum(obj);
+      break;
     case STRING:
       print_string(obj);
       break;
@@ -805,18 +1598,56 @@ void print(Object *obj) {
       print_cell(obj);
       break;
     case PRIMITIVE:
-      printf("<PRIM>");
+      if (obj->primitive.name != NULL)
+        printf("<PRIM %s>", obj->primitive.name->symbol.name);
+      else
+        printf("<PRIM>");
       break;
     case PROC:
-      printf("<PROC>");
+      if (obj->proc.name != NULL)
+        printf("<%s %s>", obj->proc.macro ? "MACRO" : "PROC", obj->proc.name->symbol.name);
+      else
+        printf("<%s>", obj->proc.macro ? "MACRO" : "PROC");
+      break;
+    case VECTOR:
+      print_vector(obj);
+      break;
+    case ARRAY:
+      printf("<ARRAY %s %d>", array_kind_name(obj->arr.kind), obj->arr.len);
+      break;
+    case HASHTABLE:
+      printf("<HASHTABLE %d>", obj->hash.count);
       break;
     default:
-      printf("\nPrint Unknown Object - type? %d\n", obj->type);
+      printf("\nPrint Unknown Object - type? %d\n", type_of(obj));
       //sleep(1);
       break;
   }
 }
 
+/* (print obj) writes OBJ as the REPL would, then a newline. */
+Object *primitive_print(Object *args) {
+  print(car(args));
+  putchar('\n');
+  return car(args);
+}
+
+/* (display obj) is print without quotes around strings or the newline. */
+Object *primitive_display(Object *args) {
+  Object *obj = car(args);
+
+  if (is_string(obj))
+    fwrite(obj->str.text, 1, obj->str.len, stdout);
+  else
+    print(obj);
+  return obj;
+}
+
+Object *primitive_newline(Object *args) {
+  putchar('\n');
+  return s_nil;
+}
+
 Object *prim_cons(Object *args) {
   return cons(car(args), cadr(args));
 }
@@ -830,10 +1661,7 @@ Object *prim_cdr(Object *args) {
 }
 
 Object *primitive_eq_num(Object *a, Object *b) {
-  int a_val = a->num.value;
-  int b_val = b->num.value;
-
-  if (a_val == b_val) {
+  if (number_compare(a, b) == 0) {
     return s_t;
   } else {
     return s_nil;
@@ -841,99 +1669,296 @@ Object *primitive_eq_num(Object *a, Object *b) {
 }
 
 Object *primitive_eq(Object *args) {
-  if (is_fixnum(car(args)) &&
-      is_fixnum(cadr(args)))
+  if (is_number(car(args)) &&
+      is_number(cadr(args)))
     return primitive_eq_num(car(args), cadr(args));
   else
     return s_nil;
 }
 
-/* Set up object allocation space. */
-void init() {
+Object *primitive_string_length(Object *args) {
+  if (!is_string(car(args)))
+    error("string-length: not a string");
 
-#ifdef GC_ENABLED
-  current_mark = 1;
-#endif
+  return make_fixnum(car(args)->str.len);
+}
 
-  free_list[0] = NULL;
+/* Size the result once, then copy each piece in bulk. */
+Object *primitive_string_append(Object *args) {
+  Object *cell;
+  int len = 0;
 
-  for (int i = 1; i <= MAX_ALLOC_SIZE; i++) {
-    Object *obj = calloc(1, sizeof(struct Object));
-    obj->id = i;
-    obj->type = UNKNOWN;
-    free_list[i] = obj;
+  for (cell = args; cell != s_nil; cell = cdr(cell)) {
+    if (!is_string(car(cell)))
+      error("string-append: not a string");
+    len += car(cell)->str.len;
   }
 
-#ifdef GC_PIN_DEBUG
-  printf("Done init.\n");
-#endif
+  char *buffer = malloc(len + 1);
+  assert(buffer != NULL);
+
+  char *p = buffer;
+  for (cell = args; cell != s_nil; cell = cdr(cell)) {
+    memcpy(p, car(cell)->str.text, car(cell)->str.len);
+    p += car(cell)->str.len;
+  }
+
+  Object *obj = make_string_len(buffer, len);
+  free(buffer);
+  return obj;
 }
 
-void run_code_tests() {
-  printf("\n\nBEGIN CODE TESTS\n");
+/* (substring str start [end]) */
+Object *primitive_substring(Object *args) {
+  Object *str = car(args);
+
+  if (!is_string(str) || !is_fixnum(cadr(args)))
+    error("substring: bad arguments");
 
-  Object *obj1 = NULL;
-  pin_variable((void **)&obj1);
-  obj1 = new_Object();
-  obj1->type = NIL;
+  long start = fixnum_value(cadr(args));
+  long end = str->str.len;
+
+  if (cddr(args) != s_nil) {
+    if (!is_fixnum(car(cddr(args))))
+      error("substring: bad end index");
+    end = fixnum_value(car(cddr(args)));
+  }
+
+  if (start < 0 || end > str->str.len || start > end)
+    error("substring: index out of range");
+
+  return make_string_len(str->str.text + start, end - start);
+}
 
-  Object *obj2 = NULL;
-  pin_variable((void **)&obj2);
-  obj2 = new_Object();
-  obj2->type = NIL;
+/* (string-search needle haystack [start])
+ * Returns the index of the first match, or nil.
+ */
+Object *primitive_string_search(Object *args) {
+  Object *needle = car(args);
+  Object *haystack = cadr(args);
+  long start = 0;
+
+  if (!is_string(needle) || !is_string(haystack))
+    error("string-search: not a string");
+
+  if (cddr(args) != s_nil) {
+    if (!is_fixnum(car(cddr(args))))
+      error("string-search: bad start index");
+    start = fixnum_value(car(cddr(args)));
+  }
 
-  Object *obj3 = NULL;
-  pin_variable((void **)&obj3);
-  obj3 = new_Object();
-  obj3->type = NIL;
+  if (start < 0 || start > haystack->str.len)
+    return s_nil;
 
-  gc();
+  char *hay = haystack->str.text + start;
+  char *found = memmem(hay, haystack->str.len - start,
+                       needle->str.text, needle->str.len);
 
-  unpin_variable((void **)&obj3);
-  unpin_variable((void **)&obj2);
-  unpin_variable((void **)&obj1);
+  if (found == NULL)
+    return s_nil;
 
-  printf("END CODE TESTS\n");
+  return make_fixnum(found - haystack->str.text);
 }
 
-void run_file_tests(char *fname) {
-  printf("\n\n----------------------------------------BEGIN FILE TESTS: %s\n", fname);
+/* Byte-wise three way compare; shorter string wins a tie. */
+int string_compare(Object *a, Object *b) {
+  int len = a->str.len < b->str.len ? a->str.len : b->str.len;
+  int result = memcmp(a->str.text, b->str.text, len);
 
-  FILE *fp = fopen(fname, "r");
+  if (result != 0)
+    return result;
 
-  if (fp == NULL) {
-    printf("File open failed: %d", errno);
-    return;
-  }
+  return a->str.len - b->str.len;
+}
 
-  Object *result = s_nil;
-  pin_variable((void **)&result);
+Object *primitive_string_eq(Object *args) {
+  Object *a = car(args);
+  Object *b = cadr(args);
 
-  while (result != NULL) {
-    printf("\n----\nREAD line from file\n");
-    result = read_lisp(fp);
-    if (result != s_nil) {
-      printf("After read:\n");
-      print(result);
-      printf("\n----\nEVALUATE from file\n");
-      printf("Before eval:\n");
-      print(result);
-      printf("\n");
-      result = eval(result, top_env);
-      printf("After eval:\n");
-      print(result);
-      printf("\n");
+  if (!is_string(a) || !is_string(b))
+    error("string=: not a string");
+
+  if (a->str.len == b->str.len &&
+      memcmp(a->str.text, b->str.text, a->str.len) == 0)
+    return s_t;
+  else
+    return s_nil;
+}
+
+Object *primitive_string_lt(Object *args) {
+  if (!is_string(car(args)) || !is_string(cadr(args)))
+    error("string<: not a string");
+
+  if (string_compare(car(args), cadr(args)) < 0)
+    return s_t;
+  else
+    return s_nil;
+}
+
+Object *primitive_number_to_string(Object *args) {
+  if (!is_number(car(args)))
+    error("number->string: not a number");
+
+  char *buffer = integer_to_string(car(args));
+  Object *obj = make_string(buffer);
+  free(buffer);
+  return obj;
+}
+
+/* Returns nil unless the whole string is a decimal integer. */
+Object *primitive_string_to_number(Object *args) {
+  Object *str = car(args);
+
+  if (!is_string(str))
+    error("string->number: not a string");
+
+  if ((int)strlen(str->str.text) != str->str.len)
+    return s_nil;
+
+  Object *obj = parse_integer(str->str.text);
+
+  if (obj == NULL)
+    return s_nil;
+
+  return obj;
+}
+
+Object *primitive_string_to_symbol(Object *args) {
+  if (!is_string(car(args)))
+    error("string->symbol: not a string");
+  // Symbol names are C strings; a NUL would cut the name short.
+  if (strlen(car(args)->str.text) != (size_t)car(args)->str.len)
+    error("string->symbol: string contains a NUL");
+
+  return intern_symbol(car(args)->str.text);
+}
+
+Object *primitive_symbol_to_string(Object *args) {
+  if (!is_symbol(car(args)))
+    error("symbol->string: not a symbol");
+
+  return make_string(car(args)->symbol.name);
+}
+
+/* (apply fn list) */
+Object *primitive_apply(Object *args) {
+  return apply(car(args), cadr(args), top_env);
+}
+
+/* (for-each-form "file" fn) reads FILE one top-level form at a time and
+ * calls FN on each, holding nothing between forms, so memory stays flat
+ * however large the file.  Blank lines and comments read as nil and are
+ * skipped, as in the file tests.  Returns the number of forms.
+ */
+Object *primitive_for_each_form(Object *args) {
+  Object *path = car(args);
+  Object *form = NULL;
+  Object *fn_args = NULL;
+  long count = 0;
+
+  if (!is_string(path))
+    error("for-each-form: path must be a string");
+
+  FILE *fp = fopen(path->str.text, "r");
+
+  if (fp == NULL)
+    error("for-each-form: cannot open file");
+  setvbuf(fp, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+  // An embedder's error handler would skip the fclose() below, so close
+  // the file on the way out and pass the error on.
+  jmp_buf handler;
+  jmp_buf *outer = interp->error_jump;
+
+  if (outer != NULL) {
+    if (setjmp(handler) != 0) {
+      interp->error_jump = outer;
+      fclose(fp);
+      longjmp(*outer, 1);
     }
+    interp->error_jump = &handler;
   }
 
-  unpin_variable((void **)&result);
+  pin_variable((void **)&args);
+  pin_variable((void **)&form);
+  pin_variable((void **)&fn_args);
+
+  while ((form = read_lisp(fp)) != NULL) {
+    if (form == s_nil)
+      continue;
 
+    fn_args = cons(form, s_nil);
+    apply(cadr(args), fn_args, top_env);
+    count++;
+  }
+
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&form);
+  unpin_variable((void **)&args);
+
+  interp->error_jump = outer;
   fclose(fp);
-  printf("END FILE TESTS\n");
+  return make_fixnum(count);
+}
+
+/* (make-vector n [fill]) */
+Object *primitive_make_vector(Object *args) {
+  if (!is_fixnum(car(args)) || fixnum_value(car(args)) < 0 ||
+      fixnum_value(car(args)) > INT_MAX)
+    error("make-vector: bad length");
+
+  return make_vector(fixnum_value(car(args)), cadr(args));
+}
+
+Object *primitive_vector(Object *args) {
+  return list_to_vector(args);
 }
 
-int main(int argc, char* argv[]) {
-  init();
+/* Check V is a vector and I a valid index, returning I. */
+int vector_index(Object *v, Object *i, char *msg) {
+  if (!is_vector(v) || !is_fixnum(i) ||
+      fixnum_value(i) < 0 || fixnum_value(i) >= v->vec.len)
+    error(msg);
+
+  return fixnum_value(i);
+}
+
+Object *primitive_vector_ref(Object *args) {
+  Object *v = car(args);
+  int i = vector_index(v, cadr(args), "vector-ref: bad index");
+
+  return v->vec.items[i];
+}
+
+Object *primitive_vector_set(Object *args) {
+  Object *v = car(args);
+  int i = vector_index(v, cadr(args), "vector-set!: bad index");
+
+  check_writable(v);
+  v->vec.items[i] = car(cddr(args));
+  return v->vec.items[i];
+}
+
+Object *primitive_vector_length(Object *args) {
+  if (!is_vector(car(args)))
+    error("vector-length: not a vector");
+
+  return make_fixnum(car(args)->vec.len);
+}
+
+/* A new interpreter with its own heap of SIZE objects, symbol
+ * table and top level environment, made current for this thread.
+ */
+struct Interp *interp_new(int size) {
+  struct Interp *in = calloc(1, sizeof(struct Interp));
+  assert(in != NULL);
+
+  interp = in;
+  heap_init(size);
+  pin_variable((void **)&in->result);
+
+  // Embedders see no evaluator trace; main() turns it on for the REPL.
+  in->quiet = 1;
 
   /* Make symbol nil (end of list). */
   s_nil = make_symbol("nil");
@@ -951,6 +1976,7 @@ int main(int argc, char* argv[]) {
   s_quote = intern_symbol("quote");
   s_setq = intern_symbol("setq");
   s_if = intern_symbol("if");
+  define_special_forms();
 
   /* Create top level environment (list of lists).
    * Head is empty list and should never change,
@@ -964,58 +1990,137 @@ int main(int argc, char* argv[]) {
   extend_top(intern_symbol("car"), make_primitive(prim_car));
   extend_top(intern_symbol("cdr"), make_primitive(prim_cdr));
 
+  extend_top(intern_symbol("length"), make_primitive(primitive_length));
+  extend_top(intern_symbol("list"), make_primitive(primitive_list));
+  extend_top(intern_symbol("append"), make_primitive(primitive_append));
+  extend_top(intern_symbol("reverse"), make_primitive(primitive_reverse));
+  extend_top(intern_symbol("nth"), make_primitive(primitive_nth));
+  extend_top(intern_symbol("member"), make_primitive(primitive_member));
+  extend_top(intern_symbol("assoc"), make_primitive(primitive_assoc));
+  extend_top(intern_symbol("map"), make_primitive(primitive_map));
+  extend_top(intern_symbol("filter"), make_primitive(primitive_filter));
+  extend_top(intern_symbol("reduce"), make_primitive(primitive_reduce));
+  extend_top(intern_symbol("sort"), make_primitive(primitive_sort));
+
   extend_top(intern_symbol("eq"), make_primitive(primitive_eq));
+  extend_top(intern_symbol("equal"), make_primitive(primitive_equal));
+  extend_top(intern_symbol("sxhash"), make_primitive(primitive_sxhash));
 
   extend_top(intern_symbol("+"), make_primitive(primitive_add));
   extend_top(intern_symbol("-"), make_primitive(primitive_sub));
   extend_top(intern_symbol("*"), make_primitive(primitive_mul));
   extend_top(intern_symbol("/"), make_primitive(primitive_div));
+  extend_top(intern_symbol("<"), make_primitive(primitive_lt));
+  extend_top(intern_symbol(">"), make_primitive(primitive_gt));
+
+  extend_top(intern_symbol("string-length"), make_primitive(primitive_string_length));
+  extend_top(intern_symbol("string-append"), make_primitive(primitive_string_append));
+  extend_top(intern_symbol("substring"), make_primitive(primitive_substring));
+  extend_top(intern_symbol("string-search"), make_primitive(primitive_string_search));
+  extend_top(intern_symbol("string="), make_primitive(primitive_string_eq));
+  extend_top(intern_symbol("string<"), make_primitive(primitive_string_lt));
+  extend_top(intern_symbol("number->string"), make_primitive(primitive_number_to_string));
+  extend_top(intern_symbol("string->number"), make_primitive(primitive_string_to_number));
+  extend_top(intern_symbol("string->symbol"), make_primitive(primitive_string_to_symbol));
+  extend_top(intern_symbol("symbol->string"), make_primitive(primitive_symbol_to_string));
+
+  extend_top(intern_symbol("apply"), make_primitive(primitive_apply));
+
+  extend_top(intern_symbol("print"), make_primitive(primitive_print));
+  extend_top(intern_symbol("display"), make_primitive(primitive_display));
+  extend_top(intern_symbol("newline"), make_primitive(primitive_newline));
+  extend_top(intern_symbol("for-each-form"), make_primitive(primitive_for_each_form));
+  extend_top(intern_symbol("parallel-map"), make_primitive(primitive_parallel_map));
+
+  extend_top(intern_symbol("make-vector"), make_primitive(primitive_make_vector));
+  extend_top(intern_symbol("vector"), make_primitive(primitive_vector));
+  extend_top(intern_symbol("vector-ref"), make_primitive(primitive_vector_ref));
+  extend_top(intern_symbol("vector-set!"), make_primitive(primitive_vector_set));
+  extend_top(intern_symbol("vector-length"), make_primitive(primitive_vector_length));
+
+  extend_top(intern_symbol("make-array"), make_primitive(primitive_make_array));
+  extend_top(intern_symbol("list->array"), make_primitive(primitive_list_to_array));
+  extend_top(intern_symbol("array->list"), make_primitive(primitive_array_to_list));
+  extend_top(intern_symbol("array-iota"), make_primitive(primitive_array_iota));
+  extend_top(intern_symbol("array-length"), make_primitive(primitive_array_length));
+  extend_top(intern_symbol("array-ref"), make_primitive(primitive_array_ref));
+  extend_top(intern_symbol("array-set!"), make_primitive(primitive_array_set));
+  extend_top(intern_symbol("array-add"), make_primitive(primitive_array_add));
+  extend_top(intern_symbol("array-mul"), make_primitive(primitive_array_mul));
+  extend_top(intern_symbol("array-sum"), make_primitive(primitive_array_sum));
+  extend_top(intern_symbol("array-dot"), make_primitive(primitive_array_dot));
+  extend_top(intern_symbol("array-min"), make_primitive(primitive_array_min));
+  extend_top(intern_symbol("array-max"), make_primitive(primitive_array_max));
+  extend_top(intern_symbol("array-prefix-sum"), make_primitive(primitive_array_prefix_sum));
+  extend_top(intern_symbol("array-map"), make_primitive(primitive_array_map));
+
+  extend_top(intern_symbol("make-hash-table"), make_primitive(primitive_make_hash_table));
+  extend_top(intern_symbol("hash-ref"), make_primitive(primitive_hash_ref));
+  extend_top(intern_symbol("hash-set!"), make_primitive(primitive_hash_set));
+  extend_top(intern_symbol("hash-remove!"), make_primitive(primitive_hash_remove));
+  extend_top(intern_symbol("hash-count"), make_primitive(primitive_hash_count));
+  extend_top(intern_symbol("hash-keys"), make_primitive(primitive_hash_keys));
+  extend_top(intern_symbol("hash-for-each"), make_primitive(primitive_hash_for_each));
+
+  extend_top(intern_symbol("memoize"), make_primitive(primitive_memoize));
+  extend_top(intern_symbol("memoized-call"), make_primitive(primitive_memoized_call));
+  extend_top(intern_symbol("memoize-stats"), make_primitive(primitive_memoize_stats));
+
+  extend_top(intern_symbol("profile-start"), make_primitive(primitive_profile_start));
+  extend_top(intern_symbol("profile-stop"), make_primitive(primitive_profile_stop));
+  extend_top(intern_symbol("profile-report"), make_primitive(primitive_profile_report));
+  extend_top(intern_symbol("profile-dump"), make_primitive(primitive_profile_dump));
+
+  extend_top(intern_symbol("alloc-report"), make_primitive(primitive_alloc_report));
+  extend_top(intern_symbol("vm-stats"), make_primitive(primitive_vm_stats));
+
+  // Time the program, not the heap setup.
+  gc_stats.start_seconds = now_seconds();
+
+  return in;
+}
 
-#ifdef CODE_TEST
-  run_code_tests();
-#endif
+/* Free IN and everything it allocated.  IN becomes current while it is
+ * torn down; afterwards no interpreter is.
+ */
+void interp_free(struct Interp *in) {
+  parallel_free(in);
+  interp = in;
+  heap_free();
+  free(in->jit_codes);
+  free(in);
+  interp = NULL;
+}
 
-#ifdef FILE_TEST
-  run_file_tests("./test0.lsp");
-  run_file_tests("./test1.lsp");
-  run_file_tests("./test2.lsp");
-  run_file_tests("./test3.lsp");
-  run_file_tests("./test4.lsp");
-  run_file_tests("./test5.lsp");
-  run_file_tests("./test6.lsp");
-  run_file_tests("./testP.lsp");
-  run_file_tests("./testP1.lsp");
-  run_file_tests("./testP2.lsp");
-  run_file_tests("./testP3.lsp");
-  run_file_tests("./testQ.lsp");
-  run_file_tests("./testQ2.lsp");
-  run_file_tests("./testQ3.lsp");
-  run_file_tests("./testR.lsp");
-  run_file_tests("./testR1.lsp");
-  run_file_tests("./testR2.lsp");
-  run_file_tests("./testS.lsp");
-  run_file_tests("./testT.lsp");
-  run_file_tests("./testU.lsp");
-  run_file_tests("./testV.lsp");
-  run_file_tests("./testW.lsp");
-  run_file_tests("./testX.lsp");
-  run_file_tests("./testY.lsp");
-  run_file_tests("./testZ.lsp");
-#endif
+/* Optimize FORM, read at top level, then evaluate it. */
+Object *eval_top(Object *form) {
+  pin_variable((void **)&form);
+  form = optimize(form, s_nil);
+  Object *result = eval(form, top_env);
+  unpin_variable((void **)&form);
+  return result;
+}
 
-#ifdef REPL
-  printf("\nWelcome to JCM-LISP. Use ctrl-c to exit.\n");
+/* Evaluate each form in FNAME, returning the last value, or NULL if the
+ * file cannot be opened.
+ */
+Object *load_file(char *fname) {
+  FILE *fp = fopen(fname, "r");
 
-  while (1) {
-    Object *result = s_nil;
+  if (fp == NULL)
+    return NULL;
 
-    printf("> ");
-    result = read_lisp(stdin);
-    result = eval(result, top_env);
-    print(result);
-    printf("\n");
-  }
-#endif
+  Object *form = NULL;
+  Object *result = s_nil;
+  pin_variable((void **)&form);
+  pin_variable((void **)&result);
 
-  return 0;
+  while ((form = read_lisp(fp)) != NULL)
+    result = eval_top(form);
+
+  unpin_variable((void **)&result);
+  unpin_variable((void **)&form);
+
+  fclose(fp);
+  return result;
 }
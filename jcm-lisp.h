@@ -15,12 +15,19 @@
 #include <string.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
 #include <assert.h>
+#include <setjmp.h>
 #include <sys/errno.h>
 
-//#define CODE_TEST
-//#define FILE_TEST
+/* Build with -DCODE_TEST or -DFILE_TEST to run the tests instead of
+ * the REPL.
+ */
+#if !defined(CODE_TEST) && !defined(FILE_TEST)
 #define REPL
+#endif
 
 typedef enum {
   UNKNOWN = 0,
@@ -30,47 +37,114 @@ typedef enum {
   SYMBOL = 4,
   CELL = 5,
   PRIMITIVE = 6,
-  PROC = 7
+  PROC = 7,
+  VECTOR = 8,
+  ARRAY = 9,
+  HASHTABLE = 10,
+  BIGNUM = 11
 } obj_type;
 
+typedef enum {
+  ARRAY_INT32 = 0,
+  ARRAY_INT64 = 1
+} array_kind;
+
+typedef enum {
+  HASH_EQ = 0,
+  HASH_EQUAL = 1
+} hash_test;
+
 typedef struct Object Object;
 typedef struct Object *primitive_fn(struct Object *);
 
-struct Fixnum {
-  int value;
+/* Fixnums are immediate: the Object pointer itself holds the value
+ * shifted left one bit with the low bit set, giving 63 bit integers
+ * that never touch the heap.  Heap objects are always aligned, so
+ * their low bit is clear.  Results outside the range become BIGNUMs.
+ */
+#define FIXNUM_MAX          (LONG_MAX >> 1)
+#define FIXNUM_MIN          (LONG_MIN >> 1)
+#define is_immediate(obj)   (((unsigned long)(obj) & 1) != 0)
+#define fixnum_value(obj)   ((long)(obj) >> 1)
+
+struct Bignum {
+  uint32_t *digits;  /* little-endian magnitude, no leading zeros */
+  int len;
+  int neg;
 };
 
 struct String {
   char *text;
+  int len;
 };
 
 struct Symbol {
   char *name;
+  int special;  /* index of the special form it names, or 0 */
+  int local;    /* ever bound in a lambda, let or loop frame */
 };
 
 struct Cell {
   struct Object *car;
   struct Object *cdr;
+  /* Evaluator caches, NULL until used.  A call site keeps the global
+   * binding of its operator and the value it held (see
+   * eval_operator()), a lambda form the symbols its body mentions
+   * and the macro_count they were collected at (see closure_env()).  The collector marks cache but not callee.
+   */
+  struct Object *cache;
+  struct Object *callee;
 };
 
 struct Primitive {
   primitive_fn *fn;
+  struct Object *name;  /* symbol it was defined as, or NULL */
+};
+
+struct Vector {
+  struct Object **items;
+  int len;
+};
+
+struct Array {
+  void *data;    /* unboxed int32_t or int64_t elements */
+  int len;
+  array_kind kind;
+};
+
+struct HashEntry {
+  struct Object *key;
+  struct Object *value;
+};
+
+struct Hash {
+  struct HashEntry *entries;
+  int capacity;  /* always a power of two */
+  int count;     /* live keys */
+  int used;      /* live keys plus tombstones */
+  hash_test test;
 };
 
 struct Proc {
   struct Object *vars;
   struct Object *body;
   struct Object *env;
+  struct Object *name;  /* symbol it was defined as, or NULL */
+  int macro;            /* set by defmacro */
+  int jit;              /* calls so far, or compiled; see jit.c */
 };
 
 struct Object {
   union {
     struct Cell cell;
     struct Symbol symbol;
-    struct Fixnum num;
+    struct Bignum big;
     struct String str;
     struct Proc proc;
     struct Primitive primitive;
+    struct Vector vec;
+    struct Array arr;
+    struct Hash hash;
   };
 
   obj_type type;
@@ -80,20 +154,149 @@ struct Object {
 
 void print(Object *);
 
-Object *symbols;    /* linked list */
-Object *s_quote;
-Object *s_define;
-Object *s_setq;
-Object *s_nil;
-Object *s_if;
-Object *s_t;
-Object *s_lambda;
+/* Counters for benchmarking; build with -DGC_STATS to report them on
+ * stderr at exit.
+ */
+struct GCStats {
+  long allocs;
+  long collections;
+  double gc_seconds;
+  double start_seconds;
+  long max_live;  /* most objects left after a collection */
+};
+
+/* Everything one interpreter owns: its symbol table, top level
+ * environment and heap.  Interpreters share nothing, so each thread can
+ * run its own without locks.
+ */
+struct Interp {
+  /* Symbol table and top level; a parallel-map worker borrows its
+   * caller's.
+   */
+  struct {
+    Object *symbols;    /* linked list */
+    Object *s_quote;
+    Object *s_define;
+    Object *s_setq;
+    Object *s_nil;
+    Object *s_if;
+    Object *s_t;
+    Object *s_lambda;
+
+    Object *top_env;
+  } roots;
+
+  /* Heap, owned by gc.c. */
+  int heap_size;
+  struct Object *heap;
+  struct Object *heap_end;  /* one past the last object */
+  void **free_list;
+  void **active_list;
+  int next_free_slot;
+  int current_mark;
+  struct PinnedVariable *pinned_variables;
+  int pinned_variable_count;
+  struct GCStats gc_stats;
+
+  /* Embedding (see embed.h): while an embedder is evaluating, error()
+   * records the message and jumps back here instead of exiting.
+   * result holds the last value handed out; it is pinned.
+   */
+  jmp_buf *error_jump;
+  char error_message[256];
+  Object *result;
+
+  /* Set unless main() runs the REPL or the file tests: only print,
+   * display and newline write to stdout, not the evaluator's trace.
+   */
+  int quiet;
+
+  /* The number of defmacros evaluated; a lambda form's cached names
+   * are redone when it changes.  See closure_env().
+   */
+  long macro_count;
 
-Object *top_env;
+  /* parallel-map's worker interpreters, made on first use, and for a
+   * worker the interpreter it works for.  See parallel.c.
+   */
+  struct Interp **workers;
+  int worker_count;
+  struct Interp *parent;
+
+  /* Native code for compiled procedures, indexed from proc.jit, and a
+   * count that turns it off while a call is evaluated after bailing
+   * out or to check a result.  See jit.c.
+   */
+  struct JitCode **jit_codes;
+  int jit_code_count;
+  int jit_off;
+};
+
+/* The interpreter this thread is running.  The names below read
+ * through it, the way errno does.
+ */
+extern __thread struct Interp *interp;
+
+#define symbols   (interp->roots.symbols)
+#define s_quote   (interp->roots.s_quote)
+#define s_define  (interp->roots.s_define)
+#define s_setq    (interp->roots.s_setq)
+#define s_nil     (interp->roots.s_nil)
+#define s_if      (interp->roots.s_if)
+#define s_t       (interp->roots.s_t)
+#define s_lambda  (interp->roots.s_lambda)
+#define top_env   (interp->roots.top_env)
+
+struct Interp *interp_new(int size);
+void interp_free(struct Interp *in);
+Object *load_file(char *fname);
 
 #define caar(obj)    car(car(obj))
 #define cadr(obj)    car(cdr(obj))
 #define cdar(obj)    cdr(car(obj))
 #define cddr(obj)    cdr(cdr(obj))
 
+Object *read_lisp(FILE *);
 Object *read_list(FILE *);
+Object *eval(Object *, Object *);
+
+Object *new_Object(obj_type type);
+Object *car(Object *);
+Object *cdr(Object *);
+Object *cons(Object *, Object *);
+Object *make_fixnum(long);
+Object *make_string(char *);
+Object *make_string_len(char *, int);
+Object *make_proc(Object *, Object *, Object *);
+Object *make_vector(int, Object *);
+Object *make_primitive(primitive_fn *);
+Object *extend_top(Object *, Object *);
+Object *extend_local(Object *, Object *, Object *);
+obj_type type_of(Object *);
+char *type_name(obj_type type);
+Object *intern_symbol(char *);
+Object *apply(Object *, Object *, Object *);
+int is_fixnum(Object *);
+int is_number(Object *);
+int is_string(Object *);
+int is_symbol(Object *);
+int is_cell(Object *);
+int is_array(Object *);
+int is_hash_table(Object *);
+int is_vector(Object *);
+int is_primitive(Object *);
+int is_proc(Object *);
+int is_param(Object *, Object *);
+char *array_kind_name(int);
+Object *eval_top(Object *);
+
+/* Builtins the optimizer folds; see optimize.c. */
+Object *primitive_add(Object *);
+Object *primitive_sub(Object *);
+Object *primitive_mul(Object *);
+Object *primitive_div(Object *);
+Object *primitive_lt(Object *);
+Object *primitive_gt(Object *);
+Object *primitive_eq(Object *);
+Object *prim_car(Object *);
+Object *prim_cdr(Object *);
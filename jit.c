@@ -0,0 +1,673 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Native code for hot procedures.
+ *
+ * A procedure called JIT_THRESHOLD times is compiled, if it can be, to
+ * x86-64 code in an mmap'd region, and later calls whose arguments are
+ * all fixnums run that instead of the evaluator.
+ *
+ * Only pure integer code is compiled: a body of one expression built
+ * from the parameters, fixnum constants, if, calls of + - * / < > and
+ * eq, and calls of the procedure itself by its global name.  Values
+ * are kept untagged in registers, one template of instructions per
+ * form.  Anything the templates do not cover (an overflow, a native
+ * stack deeper than JIT_STACK_BYTES) bails out: the native frames are
+ * dropped and the whole call is evaluated as usual, nested calls
+ * included, which is safe because the compiled code has no side
+ * effects.
+ *
+ * The globals the code relies on, the builtins and the procedure's own
+ * name, are checked on every entry, so after one is redefined calls go
+ * back to the evaluator.
+ *
+ * With JCM_JIT_CHECK set in the environment, each native result is
+ * checked against the evaluator's, and a difference is an error.
+ *
+ * parallel-map workers do not run native code, and the profiler does
+ * not see native calls.
+ *
+ */
+
+#include <stdarg.h>
+#include <sys/mman.h>
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "bignum.h"
+#include "vmstats.h"
+#include "jit.h"
+
+#ifdef JIT
+
+/* proc.jit counts calls up to JIT_THRESHOLD, then holds JIT_NEVER or
+ * the index of the compiled code in interp->jit_codes, as -2 - index.
+ */
+#define JIT_NEVER         -1
+#define jit_index(proc)   (-2 - (proc)->proc.jit)
+
+/* Jumps to patch in one procedure's code. */
+#define JIT_MAX_FIXUPS    256
+
+/* What the code left in rax. */
+typedef enum {
+  JIT_FAIL = 0,  /* not compiled */
+  JIT_INT,       /* an untagged integer */
+  JIT_BOOL       /* 1 for t, 0 for nil */
+} jit_type;
+
+typedef enum {
+  JIT_ADD,
+  JIT_SUB,
+  JIT_MUL,
+  JIT_DIV,
+  JIT_LT,
+  JIT_GT,
+  JIT_EQ
+} jit_op;
+
+static struct {
+  primitive_fn *fn;
+  jit_op op;
+} jit_builtins[] = {
+  { primitive_add, JIT_ADD },
+  { primitive_sub, JIT_SUB },
+  { primitive_mul, JIT_MUL },
+  { primitive_div, JIT_DIV },
+  { primitive_lt, JIT_LT },
+  { primitive_gt, JIT_GT },
+  { primitive_eq, JIT_EQ },
+  { NULL, 0 }
+};
+
+/* A global binding the code assumes still holds VALUE, or for a
+ * builtin any primitive running FN.
+ */
+struct JitGuard {
+  Object *binding;
+  Object *value;
+  primitive_fn *fn;
+};
+
+/* Shared with the code: the entry stub saves the stack pointer at 0,
+ * the bail out path sets bailed at 8, and each call checks the stack
+ * against the limit at 16.
+ */
+struct JitContext {
+  void *saved_sp;
+  long bailed;
+  uintptr_t stack_limit;
+};
+
+typedef long jit_entry(long *args, struct JitContext *ctx);
+
+struct JitCode {
+  jit_entry *entry;
+  void *memory;
+  size_t size;
+  int arg_count;
+  int returns_bool;
+  int check;         /* compare each result with the evaluator's */
+  struct JitGuard guards[JIT_MAX_GUARDS];
+  int guard_count;
+};
+
+/* A procedure's code as it is generated. */
+struct JitBuffer {
+  unsigned char *bytes;
+  int len;
+  int capacity;
+  Object *proc;
+  struct JitCode *code;
+  int bail_jumps[JIT_MAX_FIXUPS];  /* rel32s to the bail out path */
+  int bail_count;
+  int self_calls[JIT_MAX_FIXUPS];  /* rel32s to the procedure */
+  int self_count;
+};
+
+void jit_emit(struct JitBuffer *b, int n, ...) {
+  va_list bytes;
+
+  if (b->len + n > b->capacity) {
+    b->capacity = b->capacity == 0 ? 256 : b->capacity * 2;
+    b->bytes = realloc(b->bytes, b->capacity);
+    assert(b->bytes != NULL);
+  }
+
+  va_start(bytes, n);
+  for (int i = 0; i < n; i++)
+    b->bytes[b->len++] = va_arg(bytes, int);
+  va_end(bytes);
+}
+
+void jit_emit32(struct JitBuffer *b, int32_t value) {
+  for (int i = 0; i < 4; i++)
+    jit_emit(b, 1, (value >> (8 * i)) & 0xff);
+}
+
+void jit_emit64(struct JitBuffer *b, int64_t value) {
+  for (int i = 0; i < 8; i++)
+    jit_emit(b, 1, (int)((value >> (8 * i)) & 0xff));
+}
+
+/* Emit the opcode bytes of a jump and a rel32 to patch; its offset. */
+int jit_emit_jump(struct JitBuffer *b, int n, int op1, int op2) {
+  if (n == 1)
+    jit_emit(b, 1, op1);
+  else
+    jit_emit(b, 2, op1, op2);
+  jit_emit32(b, 0);
+  return b->len - 4;
+}
+
+void jit_patch(struct JitBuffer *b, int at, int target) {
+  int32_t rel = target - (at + 4);
+
+  memcpy(b->bytes + at, &rel, 4);
+}
+
+int jit_add_fixup(int *list, int *count, int at) {
+  if (*count == JIT_MAX_FIXUPS)
+    return 0;
+  list[(*count)++] = at;
+  return 1;
+}
+
+/* jo/jz... to the bail out path, given the second opcode byte. */
+int jit_bail_if(struct JitBuffer *b, int cc) {
+  return jit_add_fixup(b->bail_jumps, &b->bail_count, jit_emit_jump(b, 2, 0x0f, cc));
+}
+
+/* mov rax, imm64 */
+void jit_load_constant(struct JitBuffer *b, long value) {
+  jit_emit(b, 2, 0x48, 0xb8);
+  jit_emit64(b, value);
+}
+
+/* rcx = rax; pop rax: the first operand in rax, the second in rcx. */
+void jit_operands(struct JitBuffer *b) {
+  jit_emit(b, 3, 0x48, 0x89, 0xc1);
+  jit_emit(b, 1, 0x58);
+}
+
+int jit_param_index(Object *params, Object *sym) {
+  int i = 0;
+
+  for (Object *l = params; is_cell(l); l = l->cell.cdr, i++) {
+    if (l->cell.car == sym)
+      return i;
+  }
+
+  return -1;
+}
+
+/* The top level binding of SYM, or NULL. */
+Object *jit_binding(Object *sym) {
+  for (Object *l = cdr(top_env); is_cell(l); l = l->cell.cdr) {
+    if (caar(l) == sym)
+      return car(l);
+  }
+
+  return NULL;
+}
+
+int jit_add_guard(struct JitBuffer *b, Object *binding, primitive_fn *fn) {
+  struct JitCode *code = b->code;
+
+  for (int i = 0; i < code->guard_count; i++) {
+    if (code->guards[i].binding == binding)
+      return 1;
+  }
+
+  if (code->guard_count == JIT_MAX_GUARDS)
+    return 0;
+
+  code->guards[code->guard_count].binding = binding;
+  code->guards[code->guard_count].value = cdr(binding);
+  code->guards[code->guard_count].fn = fn;
+  code->guard_count++;
+  return 1;
+}
+
+int jit_guards_hold(struct JitCode *code) {
+  for (int i = 0; i < code->guard_count; i++) {
+    struct JitGuard *g = &code->guards[i];
+    Object *value = g->binding->cell.cdr;
+
+    if (g->fn != NULL ? !is_primitive(value) || value->primitive.fn != g->fn : value != g->value)
+      return 0;
+  }
+
+  return 1;
+}
+
+jit_type jit_compile_expr(struct JitBuffer *b, Object *expr);
+
+/* (+ a b ...), (- a b ...) and (* a b ...), left to right. */
+jit_type jit_compile_arith(struct JitBuffer *b, jit_op op, Object *args) {
+  if (args == s_nil) {
+    if (op == JIT_SUB)
+      return JIT_FAIL;
+    jit_load_constant(b, op == JIT_ADD ? 0 : 1);
+    return JIT_INT;
+  }
+
+  if (jit_compile_expr(b, car(args)) != JIT_INT)
+    return JIT_FAIL;
+
+  for (Object *l = cdr(args); l != s_nil; l = cdr(l)) {
+    jit_emit(b, 1, 0x50);                          // push rax
+    if (jit_compile_expr(b, car(l)) != JIT_INT)
+      return JIT_FAIL;
+    jit_operands(b);
+
+    if (op == JIT_ADD)
+      jit_emit(b, 3, 0x48, 0x01, 0xc8);            // add rax, rcx
+    else if (op == JIT_SUB)
+      jit_emit(b, 3, 0x48, 0x29, 0xc8);            // sub rax, rcx
+    else
+      jit_emit(b, 4, 0x48, 0x0f, 0xaf, 0xc1);      // imul rax, rcx
+    if (!jit_bail_if(b, 0x80))                     // jo bail
+      return JIT_FAIL;
+  }
+
+  return JIT_INT;
+}
+
+/* (/ a b), which like number_div() gives 0 for a divisor of 0. */
+jit_type jit_compile_div(struct JitBuffer *b) {
+  jit_emit(b, 3, 0x48, 0x85, 0xc9);                // test rcx, rcx
+  int nonzero = jit_emit_jump(b, 2, 0x0f, 0x85);   // jnz
+  jit_emit(b, 2, 0x31, 0xc0);                      // xor eax, eax
+  int zero_done = jit_emit_jump(b, 1, 0xe9, 0);    // jmp
+
+  // idiv faults on LONG_MIN / -1, so -1 is a negation.
+  jit_patch(b, nonzero, b->len);
+  jit_emit(b, 4, 0x48, 0x83, 0xf9, 0xff);          // cmp rcx, -1
+  int divide = jit_emit_jump(b, 2, 0x0f, 0x85);    // jne
+  jit_emit(b, 3, 0x48, 0xf7, 0xd8);                // neg rax
+  if (!jit_bail_if(b, 0x80))                       // jo bail
+    return JIT_FAIL;
+  int negated = jit_emit_jump(b, 1, 0xe9, 0);      // jmp
+
+  jit_patch(b, divide, b->len);
+  jit_emit(b, 2, 0x48, 0x99);                      // cqo
+  jit_emit(b, 3, 0x48, 0xf7, 0xf9);                // idiv rcx
+
+  jit_patch(b, zero_done, b->len);
+  jit_patch(b, negated, b->len);
+  return JIT_INT;
+}
+
+/* (/ a b), (< a b), (> a b) and (eq a b). */
+jit_type jit_compile_binary(struct JitBuffer *b, jit_op op, Object *args) {
+  if (!is_cell(cdr(args)) || cddr(args) != s_nil)
+    return JIT_FAIL;
+
+  if (jit_compile_expr(b, car(args)) != JIT_INT)
+    return JIT_FAIL;
+  jit_emit(b, 1, 0x50);                            // push rax
+  if (jit_compile_expr(b, cadr(args)) != JIT_INT)
+    return JIT_FAIL;
+  jit_operands(b);
+
+  if (op == JIT_DIV)
+    return jit_compile_div(b);
+
+  int cc = op == JIT_LT ? 0x9c : op == JIT_GT ? 0x9f : 0x94;
+
+  jit_emit(b, 3, 0x48, 0x39, 0xc8);                // cmp rax, rcx
+  jit_emit(b, 3, 0x0f, cc, 0xc0);                  // setl/setg/sete al
+  jit_emit(b, 3, 0x0f, 0xb6, 0xc0);                // movzx eax, al
+  return JIT_BOOL;
+}
+
+/* (if test then else); both branches must give the same type. */
+jit_type jit_compile_if(struct JitBuffer *b, Object *args) {
+  if (!is_cell(cdr(args)) || !is_cell(cddr(args)) || cdr(cddr(args)) != s_nil)
+    return JIT_FAIL;
+
+  if (jit_compile_expr(b, car(args)) != JIT_BOOL)
+    return JIT_FAIL;
+
+  jit_emit(b, 3, 0x48, 0x85, 0xc0);                // test rax, rax
+  int to_else = jit_emit_jump(b, 2, 0x0f, 0x84);   // jz
+  jit_type then_type = jit_compile_expr(b, cadr(args));
+  int to_end = jit_emit_jump(b, 1, 0xe9, 0);       // jmp
+
+  jit_patch(b, to_else, b->len);
+  jit_type else_type = jit_compile_expr(b, car(cddr(args)));
+
+  jit_patch(b, to_end, b->len);
+  return then_type == else_type ? then_type : JIT_FAIL;
+}
+
+/* A call of the procedure being compiled.  The arguments are pushed
+ * last first, so the callee finds them in order at its rsp.
+ */
+jit_type jit_compile_self_call(struct JitBuffer *b, Object *args) {
+  Object *items[JIT_MAX_ARGS];
+  int n = 0;
+
+  for (Object *l = args; l != s_nil; l = cdr(l))
+    items[n++] = car(l);
+
+  for (int i = n - 1; i >= 0; i--) {
+    if (jit_compile_expr(b, items[i]) != JIT_INT)
+      return JIT_FAIL;
+    jit_emit(b, 1, 0x50);                          // push rax
+  }
+
+  jit_emit(b, 3, 0x48, 0x89, 0xe7);                // mov rdi, rsp
+  if (!jit_add_fixup(b->self_calls, &b->self_count, jit_emit_jump(b, 1, 0xe8, 0)))
+    return JIT_FAIL;                               // call
+  jit_emit(b, 3, 0x48, 0x81, 0xc4);                // add rsp, 8 * n
+  jit_emit32(b, 8 * n);
+  return JIT_INT;
+}
+
+int jit_list_length(Object *list) {
+  int n = 0;
+
+  for (; is_cell(list); list = list->cell.cdr)
+    n++;
+
+  return list == s_nil ? n : -1;
+}
+
+jit_type jit_compile_expr(struct JitBuffer *b, Object *expr) {
+  Object *params = b->proc->proc.vars;
+
+  if (is_fixnum(expr)) {
+    jit_load_constant(b, fixnum_value(expr));
+    return JIT_INT;
+  }
+
+  if (is_symbol(expr)) {
+    int i = jit_param_index(params, expr);
+
+    if (i < 0)
+      return JIT_FAIL;
+    jit_emit(b, 3, 0x48, 0x8b, 0x83);              // mov rax, [rbx + 8 * i]
+    jit_emit32(b, 8 * i);
+    return JIT_INT;
+  }
+
+  if (!is_cell(expr))
+    return JIT_FAIL;
+
+  Object *op = expr->cell.car;
+  Object *args = expr->cell.cdr;
+  int argc = jit_list_length(args);
+
+  if (!is_symbol(op) || argc < 0)
+    return JIT_FAIL;
+
+  if (op->symbol.special)
+    return strcmp(op->symbol.name, "if") == 0 ? jit_compile_if(b, args) : JIT_FAIL;
+
+  if (op->symbol.local || jit_param_index(params, op) >= 0)
+    return JIT_FAIL;
+
+  Object *binding = jit_binding(op);
+
+  if (binding == NULL)
+    return JIT_FAIL;
+
+  Object *value = cdr(binding);
+
+  if (value == b->proc) {
+    if (argc != b->code->arg_count || !jit_add_guard(b, binding, NULL))
+      return JIT_FAIL;
+    return jit_compile_self_call(b, args);
+  }
+
+  if (!is_primitive(value))
+    return JIT_FAIL;
+
+  int i;
+
+  for (i = 0; jit_builtins[i].fn != NULL && jit_builtins[i].fn != value->primitive.fn; i++)
+    ;
+  if (jit_builtins[i].fn == NULL || !jit_add_guard(b, binding, value->primitive.fn))
+    return JIT_FAIL;
+
+  switch (jit_builtins[i].op) {
+    case JIT_ADD:
+    case JIT_SUB:
+    case JIT_MUL:
+      return jit_compile_arith(b, jit_builtins[i].op, args);
+    default:
+      return jit_compile_binary(b, jit_builtins[i].op, args);
+  }
+}
+
+/* The stub C calls: save the callee-saved registers we use and the
+ * stack pointer, then call the procedure with the arguments in rdi.
+ * Returns the call's rel32 to patch.
+ */
+int jit_emit_stub(struct JitBuffer *b) {
+  jit_emit(b, 1, 0x53);                            // push rbx
+  jit_emit(b, 2, 0x41, 0x54);                      // push r12
+  jit_emit(b, 3, 0x49, 0x89, 0xf4);                // mov r12, rsi
+  jit_emit(b, 4, 0x49, 0x89, 0x24, 0x24);          // mov [r12], rsp
+  int call = jit_emit_jump(b, 1, 0xe8, 0);         // call
+  jit_emit(b, 2, 0x41, 0x5c);                      // pop r12
+  jit_emit(b, 1, 0x5b);                            // pop rbx
+  jit_emit(b, 1, 0xc3);                            // ret
+  return call;
+}
+
+/* Back to the stub's frame, flagging the bail out, and return. */
+void jit_emit_bail(struct JitBuffer *b) {
+  jit_emit(b, 4, 0x49, 0x8b, 0x24, 0x24);          // mov rsp, [r12]
+  jit_emit(b, 5, 0x49, 0xc7, 0x44, 0x24, 0x08);    // mov qword [r12 + 8], 1
+  jit_emit32(b, 1);
+  jit_emit(b, 2, 0x41, 0x5c);                      // pop r12
+  jit_emit(b, 1, 0x5b);                            // pop rbx
+  jit_emit(b, 1, 0xc3);                            // ret
+}
+
+/* Put CODE in the first free slot of interp->jit_codes; its index. */
+int jit_store(struct JitCode *code) {
+  int i;
+
+  for (i = 0; i < interp->jit_code_count && interp->jit_codes[i] != NULL; i++)
+    ;
+
+  if (i == interp->jit_code_count) {
+    int count = i == 0 ? 16 : i * 2;
+
+    interp->jit_codes = realloc(interp->jit_codes, count * sizeof(struct JitCode *));
+    assert(interp->jit_codes != NULL);
+    memset(interp->jit_codes + i, 0, (count - i) * sizeof(struct JitCode *));
+    interp->jit_code_count = count;
+  }
+
+  interp->jit_codes[i] = code;
+  return i;
+}
+
+/* Compile PROC, or mark it as never to be compiled. */
+void jit_compile(Object *proc) {
+  struct JitBuffer b;
+  struct JitCode *code = calloc(1, sizeof(struct JitCode));
+  Object *body = proc->proc.body;
+
+  assert(code != NULL);
+  memset(&b, 0, sizeof(b));
+  b.proc = proc;
+  b.code = code;
+  proc->proc.jit = JIT_NEVER;
+
+  code->arg_count = jit_list_length(proc->proc.vars);
+  if (code->arg_count < 0 || code->arg_count > JIT_MAX_ARGS ||
+      !is_cell(body) || body->cell.cdr != s_nil) {
+    free(code);
+    return;
+  }
+
+  for (Object *l = proc->proc.vars; l != s_nil; l = l->cell.cdr) {
+    if (!is_symbol(l->cell.car)) {
+      free(code);
+      return;
+    }
+  }
+
+  int call = jit_emit_stub(&b);
+  int start = b.len;
+
+  jit_emit(&b, 1, 0x53);                           // push rbx
+  jit_emit(&b, 3, 0x48, 0x89, 0xfb);               // mov rbx, rdi
+  jit_emit(&b, 5, 0x49, 0x3b, 0x64, 0x24, 0x10);   // cmp rsp, [r12 + 16]
+  jit_bail_if(&b, 0x82);                           // jb bail
+
+  jit_type type = jit_compile_expr(&b, body->cell.car);
+
+  jit_emit(&b, 1, 0x5b);                           // pop rbx
+  jit_emit(&b, 1, 0xc3);                           // ret
+
+  // Self calls are taken to give integers.
+  if (type == JIT_FAIL || (type == JIT_BOOL && b.self_count > 0)) {
+    free(b.bytes);
+    free(code);
+    return;
+  }
+
+  int bail = b.len;
+
+  jit_emit_bail(&b);
+
+  jit_patch(&b, call, start);
+  for (int i = 0; i < b.self_count; i++)
+    jit_patch(&b, b.self_calls[i], start);
+  for (int i = 0; i < b.bail_count; i++)
+    jit_patch(&b, b.bail_jumps[i], bail);
+
+  void *memory = mmap(NULL, b.len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (memory == MAP_FAILED) {
+    free(b.bytes);
+    free(code);
+    return;
+  }
+
+  memcpy(memory, b.bytes, b.len);
+  free(b.bytes);
+
+  if (mprotect(memory, b.len, PROT_READ | PROT_EXEC) != 0) {
+    munmap(memory, b.len);
+    free(code);
+    return;
+  }
+
+  code->entry = (jit_entry *)memory;
+  code->memory = memory;
+  code->size = b.len;
+  code->returns_bool = type == JIT_BOOL;
+  code->check = getenv("JCM_JIT_CHECK") != NULL;
+
+  proc->proc.jit = -2 - jit_store(code);
+  vm_count(jit_compiles);
+}
+
+/* Evaluate the call the usual way and compare with the native RESULT. */
+void jit_check(Object *proc, Object *args, Object *result) {
+  Object *expected = NULL;
+
+  pin_variable((void **)&result);
+  pin_variable((void **)&expected);
+
+  interp->jit_off++;
+  expected = apply(proc, args, top_env);
+  interp->jit_off--;
+
+  int same = is_number(result) && is_number(expected) ?
+    number_compare(result, expected) == 0 : result == expected;
+
+  unpin_variable((void **)&expected);
+  unpin_variable((void **)&result);
+
+  if (!same) {
+    char message[256];
+
+    snprintf(message, sizeof(message), "jit: %s: native result differs from the evaluator's",
+             proc->proc.name != NULL ? proc->proc.name->symbol.name : "lambda");
+    error(message);
+  }
+}
+
+/* The value of applying PROC to ARGS in native code, or NULL if the
+ * evaluator has to do it.
+ */
+Object *jit_apply(Object *proc, Object *args) {
+  if (interp->parent != NULL || interp->jit_off > 0 || proc->proc.macro)
+    return NULL;
+
+  if (proc->proc.jit >= 0) {
+    if (++proc->proc.jit < JIT_THRESHOLD)
+      return NULL;
+    jit_compile(proc);
+  }
+
+  if (proc->proc.jit == JIT_NEVER)
+    return NULL;
+
+  struct JitCode *code = interp->jit_codes[jit_index(proc)];
+  long values[JIT_MAX_ARGS];
+  int n = 0;
+
+  if (!jit_guards_hold(code))
+    return NULL;
+
+  for (Object *l = args; is_cell(l); l = l->cell.cdr) {
+    if (n == code->arg_count || !is_immediate(l->cell.car))
+      return NULL;
+    values[n++] = fixnum_value(l->cell.car);
+  }
+
+  if (n != code->arg_count)
+    return NULL;
+
+  struct JitContext ctx;
+
+  ctx.bailed = 0;
+  // As an address rather than a pointer, which could not point below
+  // CTX.
+  ctx.stack_limit = (uintptr_t)&ctx - JIT_STACK_BYTES;
+
+  long value = code->entry(values, &ctx);
+  Object *result;
+
+  if (ctx.bailed) {
+    // Whatever it was would stop the nested calls too.
+    vm_count(jit_bailouts);
+    interp->jit_off++;
+    result = apply(proc, args, top_env);
+    interp->jit_off--;
+    return result;
+  }
+
+  vm_count(jit_calls);
+  result = code->returns_bool ? (value ? s_t : s_nil) : make_fixnum(value);
+
+  if (code->check)
+    jit_check(proc, args, result);
+  return result;
+}
+
+/* Release PROC's code; the collector calls this as it frees PROC. */
+void jit_free(Object *proc) {
+  if (proc->proc.jit >= JIT_NEVER)
+    return;
+
+  struct JitCode *code = interp->jit_codes[jit_index(proc)];
+
+  interp->jit_codes[jit_index(proc)] = NULL;
+  munmap(code->memory, code->size);
+  free(code);
+  proc->proc.jit = JIT_NEVER;
+}
+
+#endif // JIT
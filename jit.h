@@ -0,0 +1,36 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Native code for hot procedures.
+ *
+ */
+
+/* Build with -DJIT (make CONFIG=jit) to compile procedures called often
+ * enough to x86-64 machine code.  Without it jit_apply() is always NULL
+ * and the hooks below compile to nothing.
+ */
+#ifdef JIT
+
+#ifndef __x86_64__
+#error "-DJIT needs an x86-64 target"
+#endif
+
+/* Calls before a procedure is compiled. */
+#define JIT_THRESHOLD    32
+
+/* Most parameters a compiled procedure takes. */
+#define JIT_MAX_ARGS     8
+
+/* Most globals a compiled procedure relies on. */
+#define JIT_MAX_GUARDS   16
+
+/* Native stack a compiled call may use before it gives up. */
+#define JIT_STACK_BYTES  (256 * 1024)
+
+Object *jit_apply(Object *proc, Object *args);
+void jit_free(Object *proc);
+#else
+#define jit_apply(proc, args)  NULL
+#define jit_free(proc)
+#endif
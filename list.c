@@ -0,0 +1,374 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * List library.
+ *
+ *   (length list)              (list x ...)
+ *   (append list ... tail)     (reverse list)
+ *   (nth n list)               (member x list)
+ *   (assoc key alist)          (map fn list ...)
+ *   (filter pred list)         (reduce fn list [initial])
+ *   (sort list less)
+ *
+ * Each walks its lists in a loop, so no list is too long for the C
+ * stack, and allocates only the cells of its result: append shares
+ * its last argument, member and nth return a tail of their list, and
+ * nothing is copied that need not be.  member and assoc compare with
+ * equal.  sort is a stable merge sort of a new list; LESS decides
+ * whether its first argument goes before its second.
+ *
+ * map, filter, reduce and sort call a procedure per element.  A lambda
+ * with a fixed parameter list copies its arguments into a new frame,
+ * so for one of those the argument cells are made once and refilled
+ * for each call (see call_args()).  A primitive or a lambda with a
+ * rest parameter might keep them, so it gets fresh cells each time.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "equal.h"
+#include "list.h"
+
+/* The number of cells in the spine of LIST. */
+long list_length(Object *list, char *who) {
+  long len = 0;
+
+  for (; is_cell(list); list = list->cell.cdr)
+    len++;
+
+  if (list != s_nil)
+    error(who);
+  return len;
+}
+
+/* Append a cell holding VALUE to the list from *HEAD to *TAIL.  VALUE
+ * must be reachable by the collector; *HEAD must be pinned.
+ */
+void list_add(Object **head, Object **tail, Object *value) {
+  Object *cell = cons(value, s_nil);
+
+  if (*head == s_nil)
+    *head = cell;
+  else
+    (*tail)->cell.cdr = cell;
+  *tail = cell;
+}
+
+/* Whether FN copies its arguments out of the list it is applied to. */
+int args_reusable(Object *fn) {
+  if (!is_proc(fn) || fn->proc.macro)
+    return 0;
+
+  Object *vars = fn->proc.vars;
+
+  while (is_cell(vars))
+    vars = vars->cell.cdr;
+  return vars == s_nil;
+}
+
+/* An argument list of COUNT cells for FN: ARGS again if FN copies its
+ * arguments, otherwise new cells.  The caller fills in the cars.
+ */
+Object *call_args(Object *fn, Object *args, int count) {
+  if (args != NULL && args_reusable(fn))
+    return args;
+
+  args = s_nil;
+  for (int i = 0; i < count; i++)
+    args = cons(s_nil, args);
+  return args;
+}
+
+/* (FN X) */
+Object *call1(Object *fn, Object **args, Object *x) {
+  *args = call_args(fn, *args, 1);
+  (*args)->cell.car = x;
+  return apply(fn, *args, top_env);
+}
+
+/* (FN X Y) */
+Object *call2(Object *fn, Object **args, Object *x, Object *y) {
+  *args = call_args(fn, *args, 2);
+  (*args)->cell.car = x;
+  (*args)->cell.cdr->cell.car = y;
+  return apply(fn, *args, top_env);
+}
+
+Object *primitive_length(Object *args) {
+  return make_fixnum(list_length(car(args), "length: not a list"));
+}
+
+/* Called with the arguments it was given, which eval_args() made for
+ * this call or (apply list l) passes on from L.
+ */
+Object *primitive_list(Object *args) {
+  return args;
+}
+
+Object *primitive_append(Object *args) {
+  Object *head = s_nil;
+  Object *tail = NULL;
+
+  if (args == s_nil)
+    return s_nil;
+
+  pin_variable((void **)&head);
+
+  for (; cdr(args) != s_nil; args = cdr(args)) {
+    Object *l = car(args);
+
+    for (; is_cell(l); l = l->cell.cdr)
+      list_add(&head, &tail, l->cell.car);
+    if (l != s_nil)
+      error("append: not a list");
+  }
+
+  if (head == s_nil)
+    head = car(args);
+  else
+    tail->cell.cdr = car(args);
+
+  unpin_variable((void **)&head);
+  return head;
+}
+
+Object *primitive_reverse(Object *args) {
+  Object *result = s_nil;
+  Object *l = car(args);
+
+  pin_variable((void **)&result);
+
+  for (; is_cell(l); l = l->cell.cdr)
+    result = cons(l->cell.car, result);
+  if (l != s_nil)
+    error("reverse: not a list");
+
+  unpin_variable((void **)&result);
+  return result;
+}
+
+/* (nth n list) => element N counting from 0, or nil past the end */
+Object *primitive_nth(Object *args) {
+  Object *l = cadr(args);
+
+  if (!is_fixnum(car(args)) || fixnum_value(car(args)) < 0)
+    error("nth: bad index");
+
+  for (long n = fixnum_value(car(args)); n > 0 && is_cell(l); n--)
+    l = l->cell.cdr;
+
+  return is_cell(l) ? l->cell.car : s_nil;
+}
+
+/* (member x list) => the tail of LIST starting with X, or nil */
+Object *primitive_member(Object *args) {
+  Object *x = car(args);
+  Object *l = cadr(args);
+
+  for (; is_cell(l); l = l->cell.cdr) {
+    if (equal_objects(x, l->cell.car))
+      return l;
+  }
+
+  return s_nil;
+}
+
+/* (assoc key alist) => the first pair in ALIST whose car is KEY, or nil */
+Object *primitive_assoc(Object *args) {
+  Object *key = car(args);
+  Object *l = cadr(args);
+
+  for (; is_cell(l); l = l->cell.cdr) {
+    Object *pair = l->cell.car;
+
+    if (is_cell(pair) && equal_objects(key, pair->cell.car))
+      return pair;
+  }
+
+  return s_nil;
+}
+
+/* (map fn list ...) => FN applied to the first elements of each LIST,
+ * then the second, and so on, stopping at the end of the shortest.
+ */
+Object *primitive_map(Object *args) {
+  Object *fn = car(args);
+  Object *lists = s_nil;
+  Object *fn_args = NULL;
+  Object *head = s_nil;
+  Object *tail = NULL;
+  Object *value = NULL;
+  int count = 0;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&lists);
+  pin_variable((void **)&fn_args);
+  pin_variable((void **)&head);
+  pin_variable((void **)&value);
+
+  // LISTS holds where each list is up to, and moves along them.
+  for (Object *l = cdr(args); is_cell(l); l = l->cell.cdr) {
+    list_add(&lists, &tail, l->cell.car);
+    count++;
+  }
+  if (count == 0)
+    error("map: no lists");
+
+  for (;;) {
+    Object *l;
+    Object *a;
+
+    for (l = lists; l != s_nil && is_cell(l->cell.car); l = l->cell.cdr)
+      ;
+    if (l != s_nil)
+      break;
+
+    fn_args = call_args(fn, fn_args, count);
+    for (l = lists, a = fn_args; l != s_nil; l = l->cell.cdr, a = a->cell.cdr) {
+      a->cell.car = car(l->cell.car);
+      l->cell.car = cdr(l->cell.car);
+    }
+
+    value = apply(fn, fn_args, top_env);
+    list_add(&head, &tail, value);
+  }
+
+  unpin_variable((void **)&value);
+  unpin_variable((void **)&head);
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&lists);
+  unpin_variable((void **)&args);
+  return head;
+}
+
+/* (filter pred list) => the elements of LIST for which PRED is true */
+Object *primitive_filter(Object *args) {
+  Object *pred = car(args);
+  Object *fn_args = NULL;
+  Object *head = s_nil;
+  Object *tail = NULL;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&fn_args);
+  pin_variable((void **)&head);
+
+  for (Object *l = cadr(args); is_cell(l); l = l->cell.cdr) {
+    if (call1(pred, &fn_args, l->cell.car) != s_nil)
+      list_add(&head, &tail, l->cell.car);
+  }
+
+  unpin_variable((void **)&head);
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&args);
+  return head;
+}
+
+/* (reduce fn list [initial]) => (fn (fn (fn initial x1) x2) ...) with
+ * the first element as INITIAL if none is given; nil for an empty list
+ * without one.
+ */
+Object *primitive_reduce(Object *args) {
+  Object *fn = car(args);
+  Object *l = cadr(args);
+  Object *fn_args = NULL;
+  Object *acc = NULL;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&fn_args);
+  pin_variable((void **)&acc);
+
+  if (is_cell(cddr(args))) {
+    acc = car(cddr(args));
+  } else if (is_cell(l)) {
+    acc = l->cell.car;
+    l = l->cell.cdr;
+  } else {
+    acc = s_nil;
+  }
+
+  for (; is_cell(l); l = l->cell.cdr)
+    acc = call2(fn, &fn_args, acc, l->cell.car);
+
+  unpin_variable((void **)&acc);
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&args);
+  return acc;
+}
+
+/* Whether X goes before Y.  Fixnums under the builtin < or > are
+ * compared here rather than through apply().
+ */
+int sort_less(Object *less, Object **args, Object *x, Object *y) {
+  if (is_fixnum(x) && is_fixnum(y) && is_primitive(less)) {
+    if (less->primitive.fn == primitive_lt)
+      return fixnum_value(x) < fixnum_value(y);
+    if (less->primitive.fn == primitive_gt)
+      return fixnum_value(x) > fixnum_value(y);
+  }
+
+  return call2(less, args, x, y) != s_nil;
+}
+
+/* (sort list less) => a new list of the elements of LIST in order
+ *
+ * Bottom-up merge sort of the elements in a malloc'd array, which LIST
+ * keeps reachable meanwhile.  Runs are merged taking from the left run
+ * unless (less right left), so equal elements keep their order.
+ */
+Object *primitive_sort(Object *args) {
+  Object *less = cadr(args);
+  Object *fn_args = NULL;
+  Object *result = s_nil;
+  long n = list_length(car(args), "sort: not a list");
+
+  if (n < 2)
+    return n == 0 ? s_nil : cons(caar(args), s_nil);
+
+  Object **items = malloc(n * sizeof(Object *));
+  Object **merged = malloc(n * sizeof(Object *));
+  assert(items != NULL && merged != NULL);
+
+  long i = 0;
+  for (Object *l = car(args); is_cell(l); l = l->cell.cdr)
+    items[i++] = l->cell.car;
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&fn_args);
+  pin_variable((void **)&result);
+
+  for (long width = 1; width < n; width *= 2) {
+    for (long lo = 0; lo < n; lo += 2 * width) {
+      long mid = lo + width < n ? lo + width : n;
+      long hi = lo + 2 * width < n ? lo + 2 * width : n;
+      long a = lo, b = mid, out = lo;
+
+      while (a < mid && b < hi) {
+        if (sort_less(less, &fn_args, items[b], items[a]))
+          merged[out++] = items[b++];
+        else
+          merged[out++] = items[a++];
+      }
+      while (a < mid)
+        merged[out++] = items[a++];
+      while (b < hi)
+        merged[out++] = items[b++];
+    }
+
+    Object **swap = items;
+    items = merged;
+    merged = swap;
+  }
+
+  for (i = n - 1; i >= 0; i--)
+    result = cons(items[i], result);
+
+  free(items);
+  free(merged);
+
+  unpin_variable((void **)&result);
+  unpin_variable((void **)&fn_args);
+  unpin_variable((void **)&args);
+  return result;
+}
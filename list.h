@@ -0,0 +1,21 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * List library.
+ *
+ */
+
+long list_length(Object *list, char *who);
+
+Object *primitive_length(Object *args);
+Object *primitive_list(Object *args);
+Object *primitive_append(Object *args);
+Object *primitive_reverse(Object *args);
+Object *primitive_nth(Object *args);
+Object *primitive_member(Object *args);
+Object *primitive_assoc(Object *args);
+Object *primitive_map(Object *args);
+Object *primitive_filter(Object *args);
+Object *primitive_reduce(Object *args);
+Object *primitive_sort(Object *args);
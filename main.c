@@ -0,0 +1,241 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Based on http://web.sonoma.edu/users/l/luvisi/sl3.c
+ * and http://peter.michaux.ca/archives
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "profile.h"
+#include "alloc.h"
+#include "vmstats.h"
+#include "embed.h"
+
+void run_code_tests() {
+  printf("\n\nBEGIN CODE TESTS\n");
+
+  Object *obj1 = NULL;
+  pin_variable((void **)&obj1);
+  obj1 = new_Object(NIL);
+
+  Object *obj2 = NULL;
+  pin_variable((void **)&obj2);
+  obj2 = new_Object(NIL);
+
+  Object *obj3 = NULL;
+  pin_variable((void **)&obj3);
+  obj3 = new_Object(NIL);
+
+  gc();
+
+  unpin_variable((void **)&obj3);
+  unpin_variable((void **)&obj2);
+  unpin_variable((void **)&obj1);
+
+  printf("END CODE TESTS\n");
+}
+
+void run_file_tests(char *fname) {
+  printf("\n\n----------------------------------------BEGIN FILE TESTS: %s\n", fname);
+
+  FILE *fp = fopen(fname, "r");
+
+  if (fp == NULL) {
+    printf("File open failed: %d", errno);
+    return;
+  }
+
+  Object *result = s_nil;
+  pin_variable((void **)&result);
+
+  while (result != NULL) {
+    printf("\n----\nREAD line from file\n");
+    result = read_lisp(fp);
+    if (result != s_nil) {
+      printf("After read:\n");
+      print(result);
+      printf("\n----\nEVALUATE from file\n");
+      printf("Before eval:\n");
+      print(result);
+      printf("\n");
+      result = eval_top(result);
+      printf("After eval:\n");
+      print(result);
+      printf("\n");
+    }
+  }
+
+  unpin_variable((void **)&result);
+
+  fclose(fp);
+  printf("END FILE TESTS\n");
+}
+
+/* Like run_file_tests(), but each line of FNAME is evaluated on its
+ * own with errors caught (see embed.h), so that lines which should
+ * fail can be checked for their message.
+ */
+void run_error_tests(char *fname) {
+  printf("\n\n----------------------------------------BEGIN ERROR TESTS: %s\n", fname);
+
+  FILE *fp = fopen(fname, "r");
+
+  if (fp == NULL) {
+    printf("File open failed: %d", errno);
+    return;
+  }
+
+  char line[256];
+  Object *result = NULL;
+  pin_variable((void **)&result);
+
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (line[0] == ';' || line[0] == '\n')
+      continue;
+
+    printf("\n----\nBefore eval:\n%s", line);
+    int status = interp_eval_string(interp, line, strlen(line), &result);
+    printf("After eval:\n");
+    if (status == 0)
+      print(result);
+    else
+      printf("Error %s", interp_error(interp));
+    printf("\n");
+  }
+
+  unpin_variable((void **)&result);
+
+  fclose(fp);
+  printf("END ERROR TESTS\n");
+}
+
+/* jcm-lisp FILE... evaluates each file in turn, "-" being stdin, with
+ * the evaluator's trace off, so only print, display and newline write
+ * to stdout.  An error stops the run with status 1 (see error()); a
+ * file that cannot be opened with status 2.
+ */
+int run_batch(int argc, char *argv[]) {
+  interp->quiet = 1;
+
+  for (int i = 1; i < argc; i++) {
+    char *fname = strcmp(argv[i], "-") == 0 ? "/dev/stdin" : argv[i];
+
+    if (load_file(fname) == NULL) {
+      fprintf(stderr, "Cannot open %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  return 0;
+}
+
+#ifdef ALLOC_TRACK
+void alloc_report_at_exit() {
+  fflush(stdout);
+  alloc_report(stderr);
+}
+#endif
+
+#ifdef VM_STATS
+void vm_stats_report_at_exit() {
+  fflush(stdout);
+  vm_stats_report(stderr);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+  interp_new(MAX_ALLOC_SIZE);
+  interp->quiet = 0;
+
+#ifdef GC_STATS
+  atexit(print_gc_stats);
+#endif
+
+#ifdef ALLOC_TRACK
+  atexit(alloc_report_at_exit);
+#endif
+
+#ifdef VM_STATS
+  atexit(vm_stats_report_at_exit);
+#endif
+
+  profile_from_env();
+
+#ifdef CODE_TEST
+  run_code_tests();
+#endif
+
+#ifdef FILE_TEST
+  run_file_tests("./test0.lsp");
+  run_file_tests("./test1.lsp");
+  run_file_tests("./test2.lsp");
+  run_file_tests("./test3.lsp");
+  run_file_tests("./test4.lsp");
+  run_file_tests("./test5.lsp");
+  run_file_tests("./test6.lsp");
+  run_file_tests("./testP.lsp");
+  run_file_tests("./testP1.lsp");
+  run_file_tests("./testP2.lsp");
+  run_file_tests("./testP3.lsp");
+  run_file_tests("./testQ.lsp");
+  run_file_tests("./testQ2.lsp");
+  run_file_tests("./testQ3.lsp");
+  run_file_tests("./testR.lsp");
+  run_file_tests("./testR1.lsp");
+  run_file_tests("./testR2.lsp");
+  run_file_tests("./testS.lsp");
+  run_file_tests("./testT.lsp");
+  run_file_tests("./testU.lsp");
+  run_file_tests("./testV.lsp");
+  run_file_tests("./testW.lsp");
+  run_file_tests("./testX.lsp");
+  run_file_tests("./testY.lsp");
+  run_file_tests("./testZ.lsp");
+  run_file_tests("./testA.lsp");
+  run_file_tests("./testB.lsp");
+  run_file_tests("./testC.lsp");
+  run_file_tests("./testD.lsp");
+  run_file_tests("./testE.lsp");
+  run_file_tests("./testF.lsp");
+  run_file_tests("./testG.lsp");
+  run_file_tests("./testH.lsp");
+  run_file_tests("./testI.lsp");
+  run_file_tests("./testJ.lsp");
+  run_file_tests("./testK.lsp");
+  run_file_tests("./testL.lsp");
+  run_file_tests("./testM.lsp");
+  run_file_tests("./testN.lsp");
+  run_file_tests("./testO.lsp");
+  run_file_tests("./test7.lsp");
+  run_file_tests("./test8.lsp");
+  run_file_tests("./test9.lsp");
+  run_error_tests("./testErrors.lsp");
+#endif
+
+#ifdef REPL
+  if (argc > 1)
+    return run_batch(argc, argv);
+
+  printf("\nWelcome to JCM-LISP. Use ctrl-c to exit.\n");
+
+  Object *result = s_nil;
+  pin_variable((void **)&result);
+
+  while (1) {
+    printf("> ");
+    result = read_lisp(stdin);
+    if (result == NULL)
+      break;
+    result = eval_top(result);
+    print(result);
+    printf("\n");
+  }
+
+  unpin_variable((void **)&result);
+#endif
+
+  return 0;
+}
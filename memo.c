@@ -0,0 +1,247 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Memoization.
+ *
+ * (memoize fn [:max-entries n]) returns a procedure that calls FN and
+ * remembers the results of its last N distinct argument lists, so a
+ * repeated call costs a hash lookup.  Argument lists are compared
+ * element by element (see hash_key()).  FN should be pure: a cached
+ * result is returned without calling it.
+ *
+ * The procedure is (lambda args (memoized-call memo args)) closed over
+ * a memo, which is an ordinary vector:
+ *
+ *   fn, table, keys, values, links, count, hits, misses
+ *
+ * The table maps each argument list to a slot in keys and values.
+ * links holds the slots, plus a sentinel at the end, in a circular
+ * doubly linked list from most to least recently used, as unboxed
+ * indices.  So the collector sees only flat vectors and a hash table:
+ * entries are roots for as long as the procedure is live, never more
+ * than N of them, with no long chains to mark.
+ *
+ * Memoizing a procedure that recurses through its global name, as in
+ * (define fib (memoize (lambda (n) ... (fib (- n 1)) ...))), caches the
+ * recursive calls too.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "hash.h"
+#include "array.h"
+#include "memo.h"
+
+typedef enum {
+  MEMO_FN,
+  MEMO_TABLE,
+  MEMO_KEYS,
+  MEMO_VALUES,
+  MEMO_LINKS,
+  MEMO_COUNT,
+  MEMO_HITS,
+  MEMO_MISSES,
+  MEMO_SLOTS
+} memo_slot;
+
+#define memo_part(memo, slot)   ((memo)->vec.items[slot])
+#define memo_links(memo)        ((int64_t *)memo_part(memo, MEMO_LINKS)->arr.data)
+#define memo_capacity(memo)     (memo_part(memo, MEMO_KEYS)->vec.len)
+
+int is_memo(Object *obj) {
+  return is_vector(obj) && obj->vec.len == MEMO_SLOTS &&
+    is_hash_table(memo_part(obj, MEMO_TABLE));
+}
+
+void memo_count(Object *memo, memo_slot slot) {
+  memo_part(memo, slot) = make_fixnum(fixnum_value(memo_part(memo, slot)) + 1);
+}
+
+void memo_unlink(int64_t *links, int i) {
+  int64_t prev = links[2 * i];
+  int64_t next = links[2 * i + 1];
+
+  links[2 * prev + 1] = next;
+  links[2 * next] = prev;
+}
+
+/* Make slot I the most recently used; HEAD is the sentinel. */
+void memo_push_front(int64_t *links, int head, int i) {
+  int64_t next = links[2 * head + 1];
+
+  links[2 * i] = head;
+  links[2 * i + 1] = next;
+  links[2 * next] = i;
+  links[2 * head + 1] = i;
+}
+
+Object *make_memo(Object *fn, int capacity) {
+  Object *memo = NULL;
+  Object *part = NULL;
+
+  pin_variable((void **)&fn);
+  pin_variable((void **)&memo);
+  pin_variable((void **)&part);
+
+  memo = make_vector(MEMO_SLOTS, make_fixnum(0));
+  memo_part(memo, MEMO_FN) = fn;
+  part = make_hash_table(HASH_EQUAL);
+  memo_part(memo, MEMO_TABLE) = part;
+  part = make_vector(capacity, s_nil);
+  memo_part(memo, MEMO_KEYS) = part;
+  part = make_vector(capacity, s_nil);
+  memo_part(memo, MEMO_VALUES) = part;
+  part = make_array(ARRAY_INT64, 2 * (capacity + 1));
+  memo_part(memo, MEMO_LINKS) = part;
+
+  // An empty list: the sentinel linked to itself.
+  memo_links(memo)[2 * capacity] = capacity;
+  memo_links(memo)[2 * capacity + 1] = capacity;
+
+  unpin_variable((void **)&part);
+  unpin_variable((void **)&memo);
+  unpin_variable((void **)&fn);
+  return memo;
+}
+
+/* Remember VALUE for KEY, reusing the least recently used slot once
+ * the memo is full.
+ */
+void memo_store(Object *memo, Object *key, Object *value) {
+  Object *table = memo_part(memo, MEMO_TABLE);
+  int capacity = memo_capacity(memo);
+  Object *found = hash_get(table, key);
+  int slot;
+
+  if (found != NULL) {
+    // The call stored it already, by recursing with the same arguments.
+    slot = fixnum_value(found);
+    memo_unlink(memo_links(memo), slot);
+  } else if (fixnum_value(memo_part(memo, MEMO_COUNT)) < capacity) {
+    slot = fixnum_value(memo_part(memo, MEMO_COUNT));
+    memo_count(memo, MEMO_COUNT);
+  } else {
+    slot = memo_links(memo)[2 * capacity];
+    memo_unlink(memo_links(memo), slot);
+    hash_remove(table, memo_part(memo, MEMO_KEYS)->vec.items[slot]);
+  }
+
+  // Argument lists are made afresh for each call and nothing can
+  // change them, so the key is kept as it is.
+  memo_part(memo, MEMO_KEYS)->vec.items[slot] = key;
+  memo_part(memo, MEMO_VALUES)->vec.items[slot] = value;
+  hash_put(table, key, make_fixnum(slot));
+  memo_push_front(memo_links(memo), capacity, slot);
+}
+
+/* (memoized-call memo args), the body of a memoized procedure. */
+Object *primitive_memoized_call(Object *args) {
+  Object *memo = car(args);
+  Object *key = cadr(args);
+  Object *value = NULL;
+
+  if (!is_memo(memo))
+    error("memoized-call: not a memo");
+
+  // A parallel-map worker may not update its caller's memo.
+  if (!in_heap(memo))
+    return apply(memo_part(memo, MEMO_FN), key, top_env);
+
+  Object *found = hash_get(memo_part(memo, MEMO_TABLE), key);
+
+  if (found != NULL) {
+    int slot = fixnum_value(found);
+
+    memo_count(memo, MEMO_HITS);
+    memo_unlink(memo_links(memo), slot);
+    memo_push_front(memo_links(memo), memo_capacity(memo), slot);
+    return memo_part(memo, MEMO_VALUES)->vec.items[slot];
+  }
+
+  pin_variable((void **)&memo);
+  pin_variable((void **)&key);
+  pin_variable((void **)&value);
+
+  value = apply(memo_part(memo, MEMO_FN), key, top_env);
+  memo_count(memo, MEMO_MISSES);
+  memo_store(memo, key, value);
+
+  unpin_variable((void **)&value);
+  unpin_variable((void **)&key);
+  unpin_variable((void **)&memo);
+  return value;
+}
+
+/* (memoize fn [:max-entries n]) */
+Object *primitive_memoize(Object *args) {
+  Object *fn = car(args);
+  long capacity = MEMO_DEFAULT_ENTRIES;
+  Object *memo = NULL;
+  Object *env = NULL;
+  Object *body = NULL;
+  Object *params = intern_symbol("args");
+  Object *memo_var = intern_symbol("memo");
+
+  if (!is_proc(fn) && !is_primitive(fn))
+    error("memoize: not a procedure");
+
+  if (cdr(args) != s_nil) {
+    if (cadr(args) != intern_symbol(":max-entries") || !is_fixnum(car(cddr(args))))
+      error("memoize: expected :max-entries n");
+    capacity = fixnum_value(car(cddr(args)));
+    if (capacity < 1 || capacity > INT_MAX / 2)
+      error("memoize: bad :max-entries");
+  }
+
+  pin_variable((void **)&memo);
+  pin_variable((void **)&env);
+  pin_variable((void **)&body);
+
+  memo = make_memo(fn, capacity);
+  env = extend_local(top_env, memo_var, memo);
+  body = cons(params, s_nil);
+  body = cons(memo_var, body);
+  body = cons(intern_symbol("memoized-call"), body);
+  body = cons(body, s_nil);
+  Object *proc = make_proc(params, body, env);
+
+  unpin_variable((void **)&body);
+  unpin_variable((void **)&env);
+  unpin_variable((void **)&memo);
+  return proc;
+}
+
+/* (memoize-stats fn) => ((hits . n) (misses . n) (entries . n)
+ * (max-entries . n)) for a procedure made by memoize.
+ */
+Object *primitive_memoize_stats(Object *args) {
+  Object *fn = car(args);
+  Object *memo = is_proc(fn) && is_cell(fn->proc.env) ? cdar(fn->proc.env) : NULL;
+  Object *result = s_nil;
+  Object *pair = NULL;
+
+  if (memo == NULL || !is_memo(memo))
+    error("memoize-stats: not a memoized procedure");
+
+  char *names[] = { "max-entries", "entries", "misses", "hits" };
+  long values[] = {
+    memo_capacity(memo),
+    fixnum_value(memo_part(memo, MEMO_COUNT)),
+    fixnum_value(memo_part(memo, MEMO_MISSES)),
+    fixnum_value(memo_part(memo, MEMO_HITS))
+  };
+
+  pin_variable((void **)&result);
+  pin_variable((void **)&pair);
+
+  for (int i = 0; i < 4; i++) {
+    pair = cons(intern_symbol(names[i]), make_fixnum(values[i]));
+    result = cons(pair, result);
+  }
+
+  unpin_variable((void **)&pair);
+  unpin_variable((void **)&result);
+  return result;
+}
@@ -0,0 +1,14 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Memoization.
+ *
+ */
+
+/* Entries a memoized procedure keeps without :max-entries. */
+#define MEMO_DEFAULT_ENTRIES  1024
+
+Object *primitive_memoize(Object *args);
+Object *primitive_memoized_call(Object *args);
+Object *primitive_memoize_stats(Object *args);
@@ -0,0 +1,272 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Constant folding.
+ *
+ * optimize() rewrites a form in place before its first evaluation: a
+ * form read at top level before it is evaluated (see eval_top()), a
+ * lambda body the first time the lambda is evaluated (see
+ * closure_env()).
+ *
+ *   - a call of + - * / < > eq car or cdr whose arguments are all
+ *     constants becomes its value;
+ *   - (if test then else) with a constant test becomes then or else;
+ *   - (quote x) of a number or string becomes x.
+ *
+ * A call is folded only if its operator is not bound in any enclosing
+ * local frame and its global value is the builtin primitive.  Code
+ * folded before + is redefined keeps the builtin's result.
+ *
+ * Quoted data, macro calls, lambda forms (optimized when evaluated)
+ * and special forms not listed in optimize() are left alone.
+ *
+ */
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "vmstats.h"
+#include "optimize.h"
+
+typedef enum {
+  FOLD_NUMBERS,  /* any number of numbers */
+  FOLD_DIVIDE,   /* two numbers, the second not 0 */
+  FOLD_COMPARE,  /* two numbers */
+  FOLD_EQ,       /* two constants */
+  FOLD_LIST      /* one list */
+} fold_kind;
+
+struct Foldable {
+  primitive_fn *fn;
+  fold_kind kind;
+};
+
+static struct Foldable foldables[] = {
+  { primitive_add, FOLD_NUMBERS },
+  { primitive_sub, FOLD_NUMBERS },
+  { primitive_mul, FOLD_NUMBERS },
+  { primitive_div, FOLD_DIVIDE },
+  { primitive_lt, FOLD_COMPARE },
+  { primitive_gt, FOLD_COMPARE },
+  { primitive_eq, FOLD_EQ },
+  { prim_car, FOLD_LIST },
+  { prim_cdr, FOLD_LIST },
+  { NULL, 0 }
+};
+
+int is_constant(Object *form) {
+  switch (type_of(form)) {
+    case FIXNUM:
+    case BIGNUM:
+    case STRING:
+      return 1;
+    case SYMBOL:
+      return form == s_nil;
+    case CELL:
+      return form->cell.car == s_quote;
+    default:
+      return 0;
+  }
+}
+
+Object *constant_value(Object *form) {
+  return is_cell(form) ? cadr(form) : form;
+}
+
+/* A form that evaluates to VALUE. */
+Object *constant_form(Object *value) {
+  if (is_number(value) || is_string(value) || value == s_nil)
+    return value;
+
+  return cons(s_quote, cons(value, s_nil));
+}
+
+/* The top level value of SYM, or NULL; unlike assoc() it says nothing
+ * when there is none.
+ */
+Object *global_value(Object *sym) {
+  for (Object *l = cdr(top_env); is_cell(l); l = l->cell.cdr) {
+    if (caar(l) == sym)
+      return cdar(l);
+  }
+
+  return NULL;
+}
+
+/* The builtin a call with operator OP would run, or NULL if OP might
+ * mean something else where the call is.
+ */
+Object *builtin_operator(Object *op, Object *bound) {
+  if (!is_symbol(op) || op->symbol.local || is_param(op, bound))
+    return NULL;
+
+  return global_value(op);
+}
+
+int can_fold(fold_kind kind, Object *args) {
+  int count = 0;
+
+  for (Object *l = args; l != s_nil; l = cdr(l)) {
+    Object *value = constant_value(car(l));
+
+    if (kind != FOLD_EQ && kind != FOLD_LIST && !is_number(value))
+      return 0;
+    if (kind == FOLD_LIST && !is_cell(value) && value != s_nil)
+      return 0;
+    if (kind == FOLD_DIVIDE && count == 1 && is_fixnum(value) && fixnum_value(value) == 0)
+      return 0;
+    count++;
+  }
+
+  switch (kind) {
+    case FOLD_NUMBERS:
+      return count > 0;
+    case FOLD_LIST:
+      return count == 1;
+    default:
+      return count == 2;
+  }
+}
+
+/* The value of the call FORM as a constant form, or FORM itself if it
+ * cannot be folded.
+ */
+Object *fold_call(Object *form, Object *bound) {
+  Object *fn = builtin_operator(car(form), bound);
+
+  if (fn == NULL || type_of(fn) != PRIMITIVE)
+    return form;
+
+  struct Foldable *f;
+
+  for (f = foldables; f->fn != NULL && f->fn != fn->primitive.fn; f++)
+    ;
+  if (f->fn == NULL)
+    return form;
+
+  for (Object *l = cdr(form); l != s_nil; l = cdr(l)) {
+    if (!is_cell(l) || !is_constant(car(l)))
+      return form;
+  }
+
+  if (!can_fold(f->kind, cdr(form)))
+    return form;
+
+  Object *args = s_nil;
+  Object *tail = NULL;
+  Object *value = NULL;
+
+  pin_variable((void **)&form);
+  pin_variable((void **)&args);
+  pin_variable((void **)&value);
+
+  for (Object *l = cdr(form); l != s_nil; l = cdr(l)) {
+    value = cons(constant_value(car(l)), s_nil);
+    if (args == s_nil)
+      args = value;
+    else
+      tail->cell.cdr = value;
+    tail = value;
+  }
+
+  vm_count(folded_calls);
+  value = (*f->fn)(args);
+  value = constant_form(value);
+
+  unpin_variable((void **)&value);
+  unpin_variable((void **)&args);
+  unpin_variable((void **)&form);
+  return value;
+}
+
+/* Optimize each form of the list FORMS in place. */
+void optimize_list(Object *forms, Object *bound) {
+  pin_variable((void **)&forms);
+
+  for (Object *l = forms; is_cell(l); l = l->cell.cdr)
+    l->cell.car = optimize(l->cell.car, bound);
+
+  unpin_variable((void **)&forms);
+}
+
+/* BOUND with the variables of binding list SPECS, ((var ...) ...) or
+ * bare vars, added.
+ */
+Object *bind_specs(Object *specs, Object *bound) {
+  pin_variable((void **)&specs);
+  pin_variable((void **)&bound);
+
+  for (Object *l = specs; is_cell(l); l = l->cell.cdr) {
+    Object *spec = l->cell.car;
+
+    bound = cons(is_cell(spec) ? spec->cell.car : spec, bound);
+  }
+
+  unpin_variable((void **)&bound);
+  unpin_variable((void **)&specs);
+  return bound;
+}
+
+/* FORM optimized, where BOUND lists the local variables in scope.  The
+ * parts of FORM are rewritten in place; the result may be a new form.
+ */
+Object *optimize(Object *form, Object *bound) {
+  if (!is_cell(form))
+    return form;
+
+  Object *op = form->cell.car;
+  Object *inner = NULL;
+
+  pin_variable((void **)&form);
+  pin_variable((void **)&bound);
+  pin_variable((void **)&inner);
+
+  // Special forms cannot be rebound; see eval_list().
+  char *name = is_symbol(op) && op->symbol.special ? op->symbol.name : NULL;
+  Object *value = name == NULL ? builtin_operator(op, bound) : NULL;
+
+  if (name == NULL && value != NULL && type_of(value) == PROC && value->proc.macro) {
+    // A macro's arguments need not be code.
+  } else if (name == NULL) {
+    optimize_list(form, bound);
+    form = fold_call(form, bound);
+  } else if (strcmp(name, "quote") == 0) {
+    inner = cadr(form);
+    if (is_number(inner) || is_string(inner))
+      form = inner;
+  } else if (strcmp(name, "if") == 0) {
+    optimize_list(cdr(form), bound);
+    inner = cadr(form);
+    if (is_constant(inner)) {
+      vm_count(folded_ifs);
+      form = constant_value(inner) != s_nil ? car(cddr(form)) : cadr(cddr(form));
+    }
+  } else if (strcmp(name, "define") == 0 || strcmp(name, "setq") == 0) {
+    optimize_list(cddr(form), bound);
+  } else if (strcmp(name, "begin") == 0 || strcmp(name, "and") == 0 ||
+             strcmp(name, "or") == 0 || strcmp(name, "while") == 0) {
+    optimize_list(cdr(form), bound);
+  } else if (strcmp(name, "cond") == 0) {
+    for (Object *l = cdr(form); is_cell(l); l = l->cell.cdr)
+      optimize_list(l->cell.car, bound);
+  } else if (strcmp(name, "let") == 0) {
+    for (Object *l = cadr(form); is_cell(l); l = l->cell.cdr) {
+      if (is_cell(l->cell.car))
+        optimize_list(cdr(l->cell.car), bound);
+    }
+    inner = bind_specs(cadr(form), bound);
+    optimize_list(cddr(form), inner);
+  } else if (strcmp(name, "dotimes") == 0) {
+    inner = cadr(form);
+    if (is_cell(cdr(inner)))
+      cdr(inner)->cell.car = optimize(cadr(inner), bound);
+    inner = cons(car(inner), bound);
+    optimize_list(cddr(cadr(form)), inner);
+    optimize_list(cddr(form), inner);
+  }
+
+  unpin_variable((void **)&inner);
+  unpin_variable((void **)&bound);
+  unpin_variable((void **)&form);
+  return form;
+}
@@ -0,0 +1,11 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Constant folding.
+ *
+ */
+
+Object *optimize(Object *form, Object *bound);
+void optimize_list(Object *forms, Object *bound);
+Object *global_value(Object *sym);
@@ -0,0 +1,371 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Parallel map.
+ *
+ * (parallel-map fn list) splits LIST into one contiguous chunk per
+ * worker and maps FN over the chunks on separate threads.
+ *
+ * Each worker is an interpreter of its own (see struct Interp) with a
+ * private heap, made on first use and kept for later calls.  For the
+ * length of a call it shares the caller's symbol table and top level
+ * environment, so FN and everything it refers to are read in place:
+ *
+ *   - the caller only waits, so its objects neither move nor die;
+ *   - a worker allocates only in its own heap, and its collector marks
+ *     and sweeps only that heap (see mark()), so the workers never need
+ *     to stop each other or the caller;
+ *   - a worker may not store into the caller's objects (setq of a
+ *     global, define, vector-set! on a shared vector...), which would
+ *     leave the caller pointing into a worker's heap; that is an error.
+ *
+ * The results are copied into the caller's heap once every worker is
+ * done.  A memo table of the copies keeps shared structure shared and
+ * makes cycles safe.
+ *
+ */
+
+#include <pthread.h>
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "hash.h"
+#include "array.h"
+#include "bignum.h"
+#include "profile.h"
+#include "parallel.h"
+
+struct ParallelJob {
+  struct Interp *worker;
+  Object *fn;
+  Object **items;
+  int start;
+  int end;
+  int failed;
+};
+
+/* JCM_THREADS, or one worker per online CPU. */
+int parallel_worker_count() {
+  char *env = getenv("JCM_THREADS");
+  long n = env != NULL ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+
+  if (n < 1)
+    n = 1;
+  if (n > PARALLEL_MAX_WORKERS)
+    n = PARALLEL_MAX_WORKERS;
+  return n;
+}
+
+/* Workers split a heap as big as the caller's between them. */
+void parallel_init(struct Interp *in) {
+  int count = parallel_worker_count();
+  int size = heap_size / count;
+
+  if (size < PARALLEL_MIN_HEAP)
+    size = PARALLEL_MIN_HEAP;
+
+  in->workers = calloc(count, sizeof(struct Interp *));
+  assert(in->workers != NULL);
+
+  for (int i = 0; i < count; i++) {
+    struct Interp *w = calloc(1, sizeof(struct Interp));
+    assert(w != NULL);
+
+    interp = w;
+    heap_init(size);
+    pin_variable((void **)&w->result);
+    w->parent = in;
+    in->workers[i] = w;
+  }
+
+  interp = in;
+  in->worker_count = count;
+}
+
+void parallel_free(struct Interp *in) {
+  for (int i = 0; i < in->worker_count; i++) {
+    interp = in->workers[i];
+    heap_free();
+    free(in->workers[i]);
+  }
+
+  free(in->workers);
+  in->workers = NULL;
+  in->worker_count = 0;
+  interp = in;
+}
+
+/* Map the job's items into a vector in the worker's heap, left in the
+ * worker's result.
+ */
+void *parallel_run(void *arg) {
+  struct ParallelJob *job = arg;
+  struct Interp *in = job->worker;
+  jmp_buf handler;
+  Object *fn_args = NULL;
+  int pins;
+
+  interp = in;
+  pins = pinned_variable_count;
+
+  if (setjmp(handler) != 0) {
+    unpin_to(pins);
+    profile_depth = 0;
+    in->error_jump = NULL;
+    job->failed = 1;
+    return NULL;
+  }
+
+  in->error_jump = &handler;
+  in->result = make_vector(job->end - job->start, s_nil);
+
+  pin_variable((void **)&fn_args);
+
+  for (int i = job->start; i < job->end; i++) {
+    fn_args = cons(job->items[i], s_nil);
+    Object *value = apply(job->fn, fn_args, top_env);
+    in->result->vec.items[i - job->start] = value;
+  }
+
+  unpin_variable((void **)&fn_args);
+  in->error_jump = NULL;
+  return NULL;
+}
+
+Object *copy_from(struct Interp *from, Object *obj, Object *memo);
+
+/* Copy the cells of a list one at a time, so long lists do not recurse. */
+Object *copy_list_from(struct Interp *from, Object *obj, Object *memo) {
+  Object *head = NULL;
+  Object *tail = NULL;
+  Object *cell = NULL;
+  Object *value = NULL;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&head);
+  pin_variable((void **)&cell);
+  pin_variable((void **)&value);
+
+  while (is_cell(obj) && in_heap_of(from, obj) && hash_get(memo, obj) == NULL) {
+    cell = cons(s_nil, s_nil);
+    hash_put(memo, obj, cell);
+    if (head == NULL)
+      head = cell;
+    else
+      tail->cell.cdr = cell;
+    tail = cell;
+
+    value = copy_from(from, obj->cell.car, memo);
+    cell->cell.car = value;
+    obj = obj->cell.cdr;
+  }
+
+  // What is left is not ours, already copied, or not a cell.
+  value = copy_from(from, obj, memo);
+  if (head == NULL)
+    head = value;
+  else
+    tail->cell.cdr = value;
+
+  unpin_variable((void **)&value);
+  unpin_variable((void **)&cell);
+  unpin_variable((void **)&head);
+  unpin_variable((void **)&obj);
+  return head;
+}
+
+/* OBJ, with everything in FROM's heap copied into the current heap. */
+Object *copy_from(struct Interp *from, Object *obj, Object *memo) {
+  if (is_immediate(obj) || obj == NULL || !in_heap_of(from, obj))
+    return obj;
+
+  Object *copy = hash_get(memo, obj);
+
+  if (copy != NULL)
+    return copy;
+
+  if (is_cell(obj))
+    return copy_list_from(from, obj, memo);
+
+  Object *part = NULL;
+
+  pin_variable((void **)&obj);
+  pin_variable((void **)&copy);
+  pin_variable((void **)&part);
+
+  switch (type_of(obj)) {
+    case STRING:
+      copy = make_string_len(obj->str.text, obj->str.len);
+      break;
+    case SYMBOL:
+      copy = intern_symbol(obj->symbol.name);
+      break;
+    case BIGNUM:
+      copy = bignum_copy(obj);
+      break;
+    case ARRAY:
+      copy = make_array(obj->arr.kind, obj->arr.len);
+      memcpy(copy->arr.data, obj->arr.data, (size_t)obj->arr.len *
+             (obj->arr.kind == ARRAY_INT32 ? sizeof(int32_t) : sizeof(int64_t)));
+      break;
+    case VECTOR:
+      copy = make_vector(obj->vec.len, s_nil);
+      hash_put(memo, obj, copy);
+      for (int i = 0; i < obj->vec.len; i++) {
+        part = copy_from(from, obj->vec.items[i], memo);
+        copy->vec.items[i] = part;
+      }
+      break;
+    case HASHTABLE:
+      copy = make_hash_table(obj->hash.test);
+      hash_put(memo, obj, copy);
+      for (int i = 0; i < obj->hash.capacity; i++) {
+        struct HashEntry *entry = &obj->hash.entries[i];
+        Object *key = NULL;
+
+        if (!hash_entry_live(entry))
+          continue;
+
+        pin_variable((void **)&key);
+        key = copy_from(from, entry->key, memo);
+        part = copy_from(from, entry->value, memo);
+        hash_put(copy, key, part);
+        unpin_variable((void **)&key);
+      }
+      break;
+    case PROC:
+      copy = make_proc(s_nil, s_nil, s_nil);
+      hash_put(memo, obj, copy);
+      part = copy_from(from, obj->proc.vars, memo);
+      copy->proc.vars = part;
+      part = copy_from(from, obj->proc.body, memo);
+      copy->proc.body = part;
+      part = copy_from(from, obj->proc.env, memo);
+      copy->proc.env = part;
+      copy->proc.name = copy_from(from, obj->proc.name, memo);
+      copy->proc.macro = obj->proc.macro;
+      break;
+    case PRIMITIVE:
+      copy = make_primitive(obj->primitive.fn);
+      copy->primitive.name = copy_from(from, obj->primitive.name, memo);
+      break;
+    default:
+      copy = s_nil;
+      break;
+  }
+
+  hash_put(memo, obj, copy);
+
+  unpin_variable((void **)&part);
+  unpin_variable((void **)&copy);
+  unpin_variable((void **)&obj);
+  return copy;
+}
+
+/* (parallel-map fn list) */
+Object *primitive_parallel_map(Object *args) {
+  Object *fn = car(args);
+  Object *list = cadr(args);
+  Object *result = s_nil;
+  Object *tail = NULL;
+  Object *memo = NULL;
+  Object *value = NULL;
+  struct Interp *self = interp;
+  int len = 0;
+
+  if (self->parent != NULL)
+    error("parallel-map: cannot run inside parallel-map");
+
+  for (Object *l = list; l != s_nil; l = cdr(l)) {
+    if (!is_cell(l))
+      error("parallel-map: not a list");
+    len++;
+  }
+
+  if (len == 0)
+    return s_nil;
+
+  if (self->workers == NULL)
+    parallel_init(self);
+
+  int chunks = len < self->worker_count ? len : self->worker_count;
+  Object **items = malloc(len * sizeof(Object *));
+  struct ParallelJob *jobs = calloc(chunks, sizeof(struct ParallelJob));
+  pthread_t *threads = malloc(chunks * sizeof(pthread_t));
+
+  assert(items != NULL && jobs != NULL && threads != NULL);
+
+  int i = 0;
+  for (Object *l = list; l != s_nil; l = cdr(l))
+    items[i++] = car(l);
+
+  for (int k = 0; k < chunks; k++) {
+    struct Interp *w = self->workers[k];
+
+    w->roots = self->roots;
+    w->quiet = self->quiet;
+    w->macro_count = self->macro_count;
+    w->result = NULL;
+
+    jobs[k].worker = w;
+    jobs[k].fn = fn;
+    jobs[k].items = items;
+    jobs[k].start = (long)len * k / chunks;
+    jobs[k].end = (long)len * (k + 1) / chunks;
+
+    if (pthread_create(&threads[k], NULL, parallel_run, &jobs[k]) != 0)
+      error("parallel-map: cannot start a thread");
+  }
+
+  for (int k = 0; k < chunks; k++)
+    pthread_join(threads[k], NULL);
+
+  interp = self;
+
+  for (int k = 0; k < chunks; k++) {
+    if (jobs[k].failed) {
+      char message[sizeof(self->error_message)];
+
+      snprintf(message, sizeof(message), "%s", jobs[k].worker->error_message);
+      free(items);
+      free(jobs);
+      free(threads);
+      error(message);
+    }
+  }
+
+  pin_variable((void **)&args);
+  pin_variable((void **)&result);
+  pin_variable((void **)&memo);
+  pin_variable((void **)&value);
+
+  for (int k = 0; k < chunks; k++) {
+    Object *vec = jobs[k].worker->result;
+
+    // Each worker's objects are copied with a memo of their own.
+    memo = make_hash_table(HASH_EQ);
+
+    for (int j = 0; j < vec->vec.len; j++) {
+      value = copy_from(jobs[k].worker, vec->vec.items[j], memo);
+      value = cons(value, s_nil);
+      if (result == s_nil)
+        result = value;
+      else
+        tail->cell.cdr = value;
+      tail = value;
+    }
+
+    jobs[k].worker->result = NULL;
+  }
+
+  unpin_variable((void **)&value);
+  unpin_variable((void **)&memo);
+  unpin_variable((void **)&result);
+  unpin_variable((void **)&args);
+
+  free(items);
+  free(jobs);
+  free(threads);
+  return result;
+}
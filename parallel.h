@@ -0,0 +1,17 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Parallel map.
+ *
+ */
+
+/* Most workers an interpreter starts; JCM_THREADS picks fewer. */
+#define PARALLEL_MAX_WORKERS  64
+
+/* Smallest worker heap, in objects. */
+#define PARALLEL_MIN_HEAP     65536
+
+void parallel_free(struct Interp *in);
+
+Object *primitive_parallel_map(Object *args);
@@ -0,0 +1,314 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Sampling profiler.
+ *
+ * A SIGPROF timer copies the Lisp call stack kept by apply() into one
+ * preallocated block of frames, each sample ending with NULL.  Frames
+ * are the names procs and primitives got from define, or lambda for
+ * anonymous procs.  Names are interned symbols, which the GC never
+ * frees, so samples stay valid until reported.
+ *
+ * Reports are a flat profile and collapsed stacks ("a;b;c count"), the
+ * input format of flamegraph.pl.
+ *
+ * The timer is per process, so with several interpreter threads each
+ * sample is of whichever thread the signal lands on.
+ *
+ */
+
+#include <signal.h>
+#include <sys/time.h>
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "profile.h"
+
+__thread Object *volatile profile_stack[PROFILE_MAX_DEPTH];
+__thread volatile int profile_depth = 0;
+
+static Object **profile_frames = NULL;
+static volatile int profile_used = 0;
+static volatile long profile_samples = 0;
+static volatile long profile_dropped = 0;
+static int profile_hz = 0;
+static char *profile_path = NULL;
+
+#define TOPLEVEL "(toplevel)"
+
+void profile_sample(int sig) {
+  int depth = profile_depth;
+
+  if (depth > PROFILE_MAX_DEPTH)
+    depth = PROFILE_MAX_DEPTH;
+
+  if (profile_used + depth + 1 > PROFILE_MAX_FRAMES) {
+    profile_dropped++;
+    return;
+  }
+
+  for (int i = 0; i < depth; i++)
+    profile_frames[profile_used++] = profile_stack[i];
+  profile_frames[profile_used++] = NULL;
+  profile_samples++;
+}
+
+void profile_timer(int hz) {
+  struct itimerval timer;
+
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = hz > 0 ? 1000000 / hz : 0;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+/* Starting again discards the previous samples. */
+void profile_start(int hz) {
+  struct sigaction action;
+
+  if (hz <= 0 || hz > 1000000)
+    error("profile-start: rate must be 1 to 1000000 Hz");
+
+  profile_timer(0);
+
+  if (profile_frames == NULL) {
+    profile_frames = malloc(PROFILE_MAX_FRAMES * sizeof(Object *));
+    assert(profile_frames != NULL);
+  }
+
+  profile_used = 0;
+  profile_samples = 0;
+  profile_dropped = 0;
+  profile_hz = hz;
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = profile_sample;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGPROF, &action, NULL);
+
+  profile_timer(hz);
+}
+
+int profile_stop() {
+  profile_timer(0);
+  return profile_samples;
+}
+
+char *frame_name(Object *name) {
+  return name != NULL ? name->symbol.name : TOPLEVEL;
+}
+
+struct ProfileEntry {
+  Object *name;
+  long self;
+  long total;
+  long last_sample;  /* so recursion counts once toward total */
+};
+
+int compare_entries(const void *a, const void *b) {
+  const struct ProfileEntry *x = a, *y = b;
+
+  if (x->self != y->self)
+    return x->self < y->self ? 1 : -1;
+  if (x->total != y->total)
+    return x->total < y->total ? 1 : -1;
+  return strcmp(frame_name(x->name), frame_name(y->name));
+}
+
+struct ProfileEntry *find_entry(struct ProfileEntry **entries, int *count,
+                                int *capacity, Object *name) {
+  for (int i = 0; i < *count; i++) {
+    if ((*entries)[i].name == name)
+      return &(*entries)[i];
+  }
+
+  if (*count == *capacity) {
+    *capacity = *capacity ? *capacity * 2 : 64;
+    *entries = realloc(*entries, *capacity * sizeof(struct ProfileEntry));
+    assert(*entries != NULL);
+  }
+
+  struct ProfileEntry *entry = &(*entries)[(*count)++];
+  entry->name = name;
+  entry->self = 0;
+  entry->total = 0;
+  entry->last_sample = -1;
+  return entry;
+}
+
+/* Flat profile: per name, samples where it was the innermost frame
+ * (self) and samples where it was anywhere on the stack (total).
+ */
+void profile_report(FILE *out) {
+  struct ProfileEntry *entries = NULL;
+  int count = 0, capacity = 0;
+  long sample = 0;
+  int i = 0;
+
+  while (i < profile_used) {
+    int start = i;
+
+    while (profile_frames[i] != NULL)
+      i++;
+
+    if (i == start) {
+      struct ProfileEntry *entry = find_entry(&entries, &count, &capacity, NULL);
+
+      entry->self++;
+      entry->total++;
+    } else {
+      find_entry(&entries, &count, &capacity, profile_frames[i - 1])->self++;
+    }
+
+    for (int j = start; j < i; j++) {
+      struct ProfileEntry *entry =
+        find_entry(&entries, &count, &capacity, profile_frames[j]);
+
+      if (entry->last_sample != sample) {
+        entry->last_sample = sample;
+        entry->total++;
+      }
+    }
+
+    i++;
+    sample++;
+  }
+
+  qsort(entries, count, sizeof(struct ProfileEntry), compare_entries);
+
+  fprintf(out, "Profile: %ld samples at %d Hz", profile_samples, profile_hz);
+  if (profile_dropped > 0)
+    fprintf(out, ", %ld dropped", profile_dropped);
+  fprintf(out, "\n%7s %7s %8s  %s\n", "self%", "total%", "self", "name");
+
+  for (int k = 0; k < count; k++) {
+    double scale = profile_samples > 0 ? 100.0 / profile_samples : 0;
+
+    fprintf(out, "%6.1f%% %6.1f%% %8ld  %s\n",
+            entries[k].self * scale, entries[k].total * scale,
+            entries[k].self, frame_name(entries[k].name));
+  }
+
+  free(entries);
+}
+
+int compare_strings(const void *a, const void *b) {
+  return strcmp(*(char **)a, *(char **)b);
+}
+
+/* Collapsed stacks, outermost frame first, one line per distinct stack. */
+void profile_write_folded(FILE *out) {
+  char **stacks = malloc((profile_samples > 0 ? profile_samples : 1) * sizeof(char *));
+  long n = 0;
+  int i = 0;
+
+  assert(stacks != NULL);
+
+  while (i < profile_used) {
+    size_t len = 0;
+    int start = i;
+
+    while (profile_frames[i] != NULL)
+      len += strlen(frame_name(profile_frames[i++])) + 1;
+
+    char *stack = malloc(len + sizeof(TOPLEVEL));
+    assert(stack != NULL);
+    stack[0] = '\0';
+
+    if (i == start)
+      strcpy(stack, TOPLEVEL);
+
+    for (int j = start; j < i; j++) {
+      if (j > start)
+        strcat(stack, ";");
+      strcat(stack, frame_name(profile_frames[j]));
+    }
+
+    stacks[n++] = stack;
+    i++;
+  }
+
+  qsort(stacks, n, sizeof(char *), compare_strings);
+
+  for (long k = 0; k < n; ) {
+    long run = k;
+
+    while (run < n && strcmp(stacks[run], stacks[k]) == 0)
+      run++;
+
+    fprintf(out, "%s %ld\n", stacks[k], run - k);
+    k = run;
+  }
+
+  for (long k = 0; k < n; k++)
+    free(stacks[k]);
+  free(stacks);
+}
+
+void profile_at_exit() {
+  profile_stop();
+
+  FILE *out = fopen(profile_path, "w");
+
+  if (out == NULL) {
+    fprintf(stderr, "JCM_PROFILE: cannot write %s\n", profile_path);
+  } else {
+    profile_write_folded(out);
+    fclose(out);
+  }
+
+  fflush(stdout);
+  profile_report(stderr);
+}
+
+/* JCM_PROFILE=path profiles the whole run, writing collapsed stacks to
+ * path and the flat profile to stderr at exit.  JCM_PROFILE_HZ sets
+ * the rate.
+ */
+void profile_from_env() {
+  char *hz = getenv("JCM_PROFILE_HZ");
+
+  profile_path = getenv("JCM_PROFILE");
+  if (profile_path == NULL || *profile_path == '\0')
+    return;
+
+  profile_start(hz != NULL ? atoi(hz) : PROFILE_DEFAULT_HZ);
+  atexit(profile_at_exit);
+}
+
+/* (profile-start [hz]) */
+Object *primitive_profile_start(Object *args) {
+  Object *hz = car(args);
+
+  if (hz != s_nil && !is_fixnum(hz))
+    error("profile-start: rate must be a fixnum");
+
+  profile_start(hz == s_nil ? PROFILE_DEFAULT_HZ : fixnum_value(hz));
+  return s_t;
+}
+
+Object *primitive_profile_stop(Object *args) {
+  return make_fixnum(profile_stop());
+}
+
+Object *primitive_profile_report(Object *args) {
+  profile_report(stdout);
+  return make_fixnum(profile_samples);
+}
+
+/* (profile-dump "path") */
+Object *primitive_profile_dump(Object *args) {
+  if (!is_string(car(args)))
+    error("profile-dump: path must be a string");
+
+  FILE *out = fopen(car(args)->str.text, "w");
+
+  if (out == NULL)
+    error("profile-dump: cannot open file");
+
+  profile_write_folded(out);
+  fclose(out);
+  return make_fixnum(profile_samples);
+}
@@ -0,0 +1,43 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Sampling profiler.
+ *
+ */
+
+/* Lisp frames kept for sampling; deeper calls are counted, not kept. */
+#define PROFILE_MAX_DEPTH   1024
+
+/* Frames kept across all samples before sampling stops. */
+#define PROFILE_MAX_FRAMES  (1 << 20)
+
+#define PROFILE_DEFAULT_HZ  1000
+
+/* apply() keeps the Lisp call stack as the names of the procs and
+ * primitives being applied, one stack per thread.  A push is one store
+ * and an increment, so it stays on whether or not the profiler is
+ * running.
+ */
+extern __thread Object *volatile profile_stack[PROFILE_MAX_DEPTH];
+extern __thread volatile int profile_depth;
+
+#define profile_push(name)                            \
+  do {                                                \
+    if (profile_depth < PROFILE_MAX_DEPTH)            \
+      profile_stack[profile_depth] = (name);          \
+    profile_depth++;                                  \
+  } while (0)
+
+#define profile_pop()  (profile_depth--)
+
+void profile_start(int hz);
+int profile_stop();
+void profile_report(FILE *out);
+void profile_write_folded(FILE *out);
+void profile_from_env();
+
+Object *primitive_profile_start(Object *args);
+Object *primitive_profile_stop(Object *args);
+Object *primitive_profile_report(Object *args);
+Object *primitive_profile_dump(Object *args);
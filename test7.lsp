@@ -0,0 +1,17 @@
+; Memoized procedures with a bounded LRU cache
+(define mfib (memoize (lambda (n) (if (< n 2) n (+ (mfib (- n 1)) (mfib (- n 2))))) :max-entries 4))
+(mfib 40)
+(memoize-stats mfib)
+(define calls 0)
+(define slow-add (memoize (lambda (a b) (setq calls (+ calls 1)) (+ a b)) :max-entries 2))
+(slow-add 1 2)
+(slow-add 1 2)
+(slow-add 5 0)
+(slow-add 3 4)
+(slow-add 1 2)
+calls
+(memoize-stats slow-add)
+:max-entries
+(define h (make-hash-table 'equal))
+(hash-set! h '(1 (2 "three")) 'found)
+(hash-ref h (cons 1 (cons (cons 2 (cons "three" nil)) nil)))
@@ -0,0 +1,17 @@
+; Structural equality and sxhash
+(equal '(1 (2 "three") four) '(1 (2 "three") four))
+(equal '(1 (2 "three") four) '(1 (2 "thre") four))
+(equal '(1 2) '(1 2 3))
+(equal '(1 2 . 3) '(1 2 . 3))
+(equal "abc" (string-append "a" "bc"))
+(equal 100000000000000000000 (* 10000000000 10000000000))
+(equal 'a 'a)
+(equal 1 "1")
+(eq (sxhash '((a . 1) "b" 3)) (sxhash '((a . 1) "b" 3)))
+(eq (sxhash "abc") (sxhash (string-append "ab" "c")))
+(> (sxhash '(x y)) -1)
+(car (define xs (array->list (array-iota 'int64 100))))
+(car (define ys (array->list (array-iota 'int64 100))))
+(equal xs ys)
+(eq (sxhash xs) (sxhash ys))
+(equal xs (cdr ys))
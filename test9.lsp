@@ -0,0 +1,26 @@
+; Native list library
+(length '(1 2 3))
+(length nil)
+(list 1 (+ 1 1) "three")
+(append '(1 2) nil '(3) '(4 . 5))
+(append nil '(1))
+(reverse '(1 (2 3) 4))
+(nth 1 '(a b c))
+(nth 5 '(a b c))
+(member '(2) '(1 (2) 3))
+(member 9 '(1 2))
+(assoc "b" '(("a" . 1) ("b" . 2)))
+(map (lambda (x) (* x x)) '(1 2 3))
+(map + '(1 2 3) '(10 20))
+(map list '(1 2) '(a b))
+(filter (lambda (x) (< x 3)) '(1 5 2 6 0))
+(reduce + '(1 2 3 4))
+(reduce (lambda (acc x) (cons x acc)) '(1 2 3) nil)
+(reduce + nil)
+(sort '(3 1 2 5 4) <)
+(sort '((b . 2) (a . 1) (c . 2) (d . 1)) (lambda (x y) (< (cdr x) (cdr y))))
+(sort nil <)
+(car (define ns (reverse (array->list (array-iota 'int64 30)))))
+(equal (sort ns <) (array->list (array-iota 'int64 30)))
+(reduce + (map (lambda (x y) (* x y)) ns ns) 0)
+(length (filter (lambda (x) (> x 14)) ns))
@@ -0,0 +1,17 @@
+(define s (string-append "hello" ", " "world"))
+s
+(string-length s)
+(substring s 7)
+(substring s 0 5)
+(string-search "world" s)
+(string-search "o" s 5)
+(string-search "xyz" s)
+(string= "abc" "abc")
+(string= "abc" "abd")
+(string< "abc" "abd")
+(string< "abc" "ab")
+(number->string 1234)
+(string->number "42")
+(string->number "4x2")
+(string->symbol "foo")
+(symbol->string 'bar)
@@ -0,0 +1,9 @@
+(define v (make-vector 5 0))
+v
+(vector-set! v 2 'two)
+(vector-ref v 2)
+(vector-length v)
+#(1 2 (3 4) "five")
+(vector-ref #(a b c) 1)
+(vector 1 (+ 1 1) 3)
+#()
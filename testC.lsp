@@ -0,0 +1,22 @@
+(define a (list->array 'int32 '(3 1 4 1 5 9 2 6 5 3 5)))
+a
+(array-length a)
+(array-ref a 5)
+(array-sum a)
+(array-min a)
+(array-max a)
+(array->list (array-add a a))
+(array->list (array-mul a a))
+(array-dot a a)
+(array->list (array-prefix-sum a))
+(define b (array-iota 'int64 10))
+(array-set! b 0 100)
+(array->list b)
+(array-sum b)
+(array->list (array-map (lambda (x) (* x 3)) b))
+(array-sum (make-array 'int64 20 2))
+(apply + '(1 2 3))
+(define big (list->array 'int64 '(4000000000000000000 -4000000000000000000 4000000000000000000)))
+(array-sum big)
+(array-dot big (list->array 'int64 '(1 1 0)))
+(array-dot (list->array 'int32 '(2147483647 2147483647)) (list->array 'int32 '(2147483647 2147483647)))
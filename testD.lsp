@@ -0,0 +1,24 @@
+(define h (make-hash-table))
+(hash-set! h 'apple 1)
+(hash-set! h "pear" 2)
+(hash-set! h 42 'answer)
+(hash-ref h 'apple)
+(hash-ref h "pear")
+(hash-ref h 42)
+(hash-ref h 'missing 'none)
+(hash-count h)
+(hash-remove! h 'apple)
+(hash-remove! h 'apple)
+(hash-count h)
+(hash-keys h)
+(define e (make-hash-table 'eq))
+(hash-set! e 'k 'v)
+(hash-ref e 'k)
+(hash-ref e "k")
+(define n (make-hash-table))
+(hash-set! n 'a 1)
+(hash-set! n 'b 2)
+(hash-set! n 'c 3)
+(define total 0)
+(hash-for-each n (lambda (k v) (setq total (+ total v))))
+total
@@ -0,0 +1,19 @@
+4611686018427387903
+(+ 4611686018427387903 1)
+(- -4611686018427387904 1)
+(* 4294967296 4294967296)
+(* 123456789012345678901234567890 987654321098765432109876543210)
+(/ 121932631137021795226185032733622923332237463801111263526900 987654321098765432109876543210)
+(- (+ 4611686018427387903 1) 1)
+(< 99999999999999999999 100000000000000000000)
+(> -99999999999999999999 -100000000000000000000)
+(eq 100000000000000000000 (* 10000000000 10000000000))
+(string->number "-123456789012345678901234567890")
+(number->string (* 99999999999 99999999999))
+(define fact (lambda (n) (if (eq n 0) 1 (* n (fact (- n 1))))))
+(fact 30)
+(/ (fact 30) (fact 28))
+-42
+(- 7)
+(+ (- 0 123456789012345678901234567890) 1)
+(- 111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111 11111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111)
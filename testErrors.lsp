@@ -0,0 +1,15 @@
+; Errors, one line each: arithmetic on things that are not numbers
+(+ "abc" 1)
+(- 1 (quote a))
+(- "abc")
+(* (make-vector 3 0) 2)
+(+ (quote (1 2)) 1)
+(/ 10 "2")
+(+ 1 2 4611686018427387904)
+; Array values an element cannot hold, and a fill that is not a number
+(array-set! (make-array 'int32 1) 0 5000000000)
+(list->array 'int32 '(1 2147483648))
+(make-array 'int32 2 -2147483649)
+(make-array 'int64 2 "x")
+(array-map (lambda (x) (* x 4294967296)) (list->array 'int32 '(0 1)))
+(array->list (list->array 'int32 '(2147483647 -2147483648)))
@@ -0,0 +1,11 @@
+(define square (lambda (x) (* x x)))
+square
+car
+(define also-square square)
+also-square
+(lambda (x) x)
+(profile-start 1000)
+(square 12)
+(profile-stop)
+(alloc-report)
+(vm-stats)
@@ -0,0 +1,9 @@
+; print, display and newline, the output primitives batch mode keeps
+(print 42)
+(print "string")
+(print '(1 "two" three))
+(display "no quotes")
+(newline)
+(display 'sym)
+(newline)
+(eq (print 7) 7)
@@ -0,0 +1,7 @@
+; for-each-form streams a file one form at a time
+(define seen 0)
+(for-each-form "./testG.lsp" (lambda (form) (setq seen (+ seen 1))))
+seen
+(define heads nil)
+(for-each-form "./testG.lsp" (lambda (form) (setq heads (cons (car form) heads))))
+heads
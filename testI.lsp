@@ -0,0 +1,8 @@
+; parallel-map maps on worker threads and keeps the order
+(define sq (lambda (x) (* x x)))
+(parallel-map sq '(1 2 3 4 5 6 7 8 9 10))
+(parallel-map (lambda (s) (cons s (string-length s))) '("a" "bb" "ccc"))
+(parallel-map (lambda (x) (* x 4611686018427387904)) '(2 3))
+(define adders (parallel-map (lambda (n) (lambda (x) (+ x n))) '(10 20)))
+((car adders) 5)
+(parallel-map sq nil)
@@ -0,0 +1,21 @@
+; let, cond, and, or, while and begin are special forms
+(define x 10)
+(let ((x 1) (y x)) (+ x y))
+x
+(let (z) z)
+(define sign (lambda (n) (cond ((< n 0) -1) ((> n 0) 1) (t 0))))
+(sign -5)
+(sign 5)
+(sign 0)
+(cond ((< 2 1) 1))
+(and)
+(and 1 2 3)
+(and 1 nil 3)
+(or)
+(or nil 2 3)
+(or nil nil)
+(define i 0)
+(define total 0)
+(while (< i 5) (setq total (+ total i)) (setq i (+ i 1)))
+total
+(begin 1 2 3)
@@ -0,0 +1,9 @@
+; dotimes and do loop with bindings updated in place
+(define total 0)
+(dotimes (i 5) (setq total (+ total i)))
+total
+(dotimes (i 3 i))
+(dotimes (i 0 'none))
+(do ((i 0 (+ i 1)) (acc nil (cons i acc))) ((eq i 4) acc))
+(do ((a 1 b) (b 2 a) (n 0 (+ n 1))) ((eq n 3) (cons a b)))
+(do ((i 0 (+ i 1)) (k 7)) ((eq i 2) k))
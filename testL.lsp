@@ -0,0 +1,13 @@
+; defmacro: each call site is expanded once and rewritten in place
+(defmacro when (test . body) (cons 'if (cons test (cons (cons 'begin body) nil))))
+(defmacro unless (test . body) (cons 'if (cons test (cons nil (cons (cons 'begin body) nil)))))
+(when (< 1 2) 'a 'b)
+(unless (< 1 2) 'a)
+(define sum (lambda (xs) (define total 0) (dotimes (i (string-length xs)) (when (> i 0) (setq total (+ total i)))) total))
+(sum "abcd")
+sum
+(defmacro always-seven () 7)
+(always-seven)
+(define rest (lambda (a . more) more))
+(rest 1 2 3)
+'(a b . c)
@@ -0,0 +1,20 @@
+; Closures capture only the locals they use, sharing the bindings
+(define make-counter (lambda () (let ((n 0) (unused "big")) (lambda () (setq n (+ n 1)) n))))
+(define c (make-counter))
+(c)
+(c)
+(define shared (lambda (x) (let ((get (lambda () x)) (set (lambda (v) (setq x v)))) (set 5) (get))))
+(shared 1)
+(define add3 (lambda (a) (lambda (b) (lambda (c) (+ a b c)))))
+(((add3 1) 2) 3)
+(define rest-closure (lambda (a . more) (lambda () more)))
+((rest-closure 1 2 3))
+(define outer (lambda (x) (let ((f (lambda (y) (+ x y)))) (f 10))))
+(outer 5)
+(defmacro get-x () 'x)
+(define mk (lambda (x) (lambda () (get-x))))
+((mk 5))
+(define mk (lambda (x) (lambda () (get-late))))
+(mk 1)
+(defmacro get-late () 'x)
+((mk 5))
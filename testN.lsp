@@ -0,0 +1,22 @@
+; Constant folding before evaluation
+(+ 1 (* 2 3) (- 10 4))
+(define hours (lambda (d) (* d (* 24 60 60))))
+(hours 2)
+(define pick (lambda (x) (if (< 1 2) (+ x 1) (car x))))
+(pick 41)
+(define first (lambda () (car '(3 4))))
+(first)
+(define rest (lambda () (cdr '(3 4))))
+(rest)
+(define same (lambda () (eq 7 (+ 3 4))))
+(same)
+(define quoted (lambda () (+ '5 (quote 6))))
+(quoted)
+(define shadow (lambda (+) (+ 1 2)))
+(shadow -)
+(define let-shadow (lambda () (let ((* +)) (* 3 4))))
+(let-shadow)
+(define huge (lambda () (* 4611686018427387904 4)))
+(huge)
+(define nested (lambda (n) (let ((k (* 2 (+ 1 1)))) (dotimes (i (- 5 2) (* k n)) (setq n (+ n (* 0 1)))))))
+(nested 3)
@@ -0,0 +1,16 @@
+; Hot numeric procedures, which a -DJIT build runs as native code
+(define fib (lambda (n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2))))))
+(fib 15)
+(define quot (lambda (a b) (/ (- (* a 3) 1) b)))
+(dotimes (i 40 (quot 100 7)) (quot i 3))
+(quot 100 0)
+(quot -100 -1)
+(quot 4611686018427387903 1)
+(define less (lambda (a b) (if (eq a b) (< a 0) (< a b))))
+(dotimes (i 40 (less 5 5)) (less i 3))
+(less -5 -5)
+(define pow2 (lambda (n) (if (eq n 0) 1 (* 2 (pow2 (- n 1))))))
+(dotimes (i 40 (pow2 62)) (pow2 3))
+(define old-fib fib)
+(define fib (lambda (n) 100))
+(old-fib 5)
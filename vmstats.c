@@ -0,0 +1,120 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Evaluator counters.
+ *
+ */
+
+#include <stddef.h>
+
+#include "jcm-lisp.h"
+#include "gc.h"
+#include "vmstats.h"
+
+#ifdef VM_STATS
+
+__thread struct VMStats vm_stats;
+
+/* Offsets rather than addresses: vm_stats is per thread. */
+struct VMCounter {
+  char *name;
+  size_t offset;
+};
+
+#define vm_counter(c)  (*(long *)((char *)&vm_stats + (c)->offset))
+
+static struct VMCounter counters[] = {
+  { "form-quote", offsetof(struct VMStats, form_quote) },
+  { "form-if", offsetof(struct VMStats, form_if) },
+  { "form-define", offsetof(struct VMStats, form_define) },
+  { "form-setq", offsetof(struct VMStats, form_setq) },
+  { "form-lambda", offsetof(struct VMStats, form_lambda) },
+  { "form-let", offsetof(struct VMStats, form_let) },
+  { "form-cond", offsetof(struct VMStats, form_cond) },
+  { "form-and", offsetof(struct VMStats, form_and) },
+  { "form-or", offsetof(struct VMStats, form_or) },
+  { "form-while", offsetof(struct VMStats, form_while) },
+  { "form-dotimes", offsetof(struct VMStats, form_dotimes) },
+  { "form-do", offsetof(struct VMStats, form_do) },
+  { "form-begin", offsetof(struct VMStats, form_begin) },
+  { "form-defmacro", offsetof(struct VMStats, form_defmacro) },
+  { "form-call", offsetof(struct VMStats, form_call) },
+  { "macro-expansions", offsetof(struct VMStats, macro_expansions) },
+  { "call-cache-hits", offsetof(struct VMStats, call_cache_hits) },
+  { "call-cache-misses", offsetof(struct VMStats, call_cache_misses) },
+  { "folded-calls", offsetof(struct VMStats, folded_calls) },
+  { "folded-ifs", offsetof(struct VMStats, folded_ifs) },
+  { "apply-primitive", offsetof(struct VMStats, apply_primitive) },
+  { "apply-proc", offsetof(struct VMStats, apply_proc) },
+  { "jit-compiles", offsetof(struct VMStats, jit_compiles) },
+  { "jit-calls", offsetof(struct VMStats, jit_calls) },
+  { "jit-bailouts", offsetof(struct VMStats, jit_bailouts) },
+  { "assoc-calls", offsetof(struct VMStats, assoc_calls) },
+  { "assoc-steps", offsetof(struct VMStats, assoc_steps) },
+  { "assoc-misses", offsetof(struct VMStats, assoc_misses) },
+  { "symbol-lookups", offsetof(struct VMStats, symbol_lookups) },
+  { "symbol-steps", offsetof(struct VMStats, symbol_steps) },
+  { NULL, 0 }
+};
+
+void vm_stats_report(FILE *out) {
+  fprintf(out, "VM stats:\n");
+
+  for (int i = 0; i <= BIGNUM; i++) {
+    if (vm_stats.evals[i] > 0)
+      fprintf(out, "  eval %-20s %ld\n", type_name(i), vm_stats.evals[i]);
+  }
+
+  for (struct VMCounter *c = counters; c->name != NULL; c++)
+    fprintf(out, "  %-25s %ld\n", c->name, vm_counter(c));
+
+  if (vm_stats.assoc_calls > 0)
+    fprintf(out, "  %-25s %.2f\n", "assoc-average-steps",
+            (double)vm_stats.assoc_steps / vm_stats.assoc_calls);
+}
+
+/* (vm-stats) => ((eval-CELL . n) ... (form-quote . n) ...) */
+Object *primitive_vm_stats(Object *args) {
+  Object *list = s_nil;
+  Object *name = NULL;
+  Object *pair = NULL;
+  char buff[64];
+
+  pin_variable((void **)&list);
+  pin_variable((void **)&name);
+  pin_variable((void **)&pair);
+
+  // Counters in table order: walk it backwards, consing on the front.
+  for (int i = (int)(sizeof(counters) / sizeof(counters[0])) - 2; i >= 0; i--) {
+    name = intern_symbol(counters[i].name);
+    pair = cons(name, make_fixnum(vm_counter(&counters[i])));
+    list = cons(pair, list);
+  }
+
+  for (int i = BIGNUM; i >= 0; i--) {
+    if (vm_stats.evals[i] == 0)
+      continue;
+    snprintf(buff, sizeof(buff), "eval-%s", type_name(i));
+    name = intern_symbol(buff);
+    pair = cons(name, make_fixnum(vm_stats.evals[i]));
+    list = cons(pair, list);
+  }
+
+  unpin_variable((void **)&pair);
+  unpin_variable((void **)&name);
+  unpin_variable((void **)&list);
+  return list;
+}
+
+#else
+
+void vm_stats_report(FILE *out) {
+  fprintf(out, "VM stats are off; build with -DVM_STATS.\n");
+}
+
+Object *primitive_vm_stats(Object *args) {
+  return s_nil;
+}
+
+#endif // VM_STATS
@@ -0,0 +1,58 @@
+/* -*- c-basic-offset: 2 ; -*- */
+/*
+ * JCM-LISP
+ *
+ * Evaluator counters.
+ *
+ */
+
+/* Build with -DVM_STATS (make CONFIG=vmstats) to count what the
+ * evaluator does.  Each vm_count() is a single increment; without
+ * VM_STATS it compiles to nothing.
+ */
+#ifdef VM_STATS
+struct VMStats {
+  long evals[BIGNUM + 1];  /* by type of the form evaluated */
+  long form_quote;
+  long form_if;
+  long form_define;
+  long form_setq;
+  long form_lambda;
+  long form_let;
+  long form_cond;
+  long form_and;
+  long form_or;
+  long form_while;
+  long form_dotimes;
+  long form_do;
+  long form_begin;
+  long form_defmacro;
+  long form_call;
+  long macro_expansions;
+  long call_cache_hits;
+  long call_cache_misses;  /* operator symbols looked up */
+  long folded_calls;
+  long folded_ifs;
+  long apply_primitive;
+  long apply_proc;
+  long jit_compiles;
+  long jit_calls;
+  long jit_bailouts;       /* native calls finished by the evaluator */
+  long assoc_calls;
+  long assoc_steps;        /* bindings compared, over all calls */
+  long assoc_misses;
+  long symbol_lookups;
+  long symbol_steps;       /* symbol table entries compared */
+};
+
+/* Per thread, so interpreters on different threads never share a line. */
+extern __thread struct VMStats vm_stats;
+
+#define vm_count(counter)  (vm_stats.counter++)
+#else
+#define vm_count(counter)
+#endif
+
+void vm_stats_report(FILE *out);
+
+Object *primitive_vm_stats(Object *args);